@@ -52,6 +52,7 @@ BENCHMARK( bm_push_back< std::vector       < int > > )->RangeMultiplier( 2 )->Ra
 BENCHMARK( bm_push_back< npl::vector       < int > > )->RangeMultiplier( 2 )->Range( 256, 256 << 8 )->Unit( benchmark::kMicrosecond );
 BENCHMARK( bm_push_back< npl::prefix_vector< int > > )->RangeMultiplier( 2 )->Range( 256, 256 << 8 )->Unit( benchmark::kMicrosecond );
 BENCHMARK( bm_push_back< npl::fenwick_tree < int > > )->RangeMultiplier( 2 )->Range( 256, 256 << 8 )->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_push_back< npl::segment_tree < int > > )->RangeMultiplier( 2 )->Range( 256, 256 << 8 )->Unit( benchmark::kMicrosecond );
 #endif
 
 #ifdef NPL_BENCH_PUSH_BACK_RESERVE
@@ -61,6 +62,100 @@ BENCHMARK( bm_push_back_reserve< npl::prefix_vector< int > > )->RangeMultiplier(
 BENCHMARK( bm_push_back_reserve< npl::fenwick_tree < int > > )->RangeMultiplier( 2 )->Range( 256, 256 << 8 )->Unit( benchmark::kMicrosecond );
 #endif
 
+#ifdef NPL_BENCH_RANGE
+BENCHMARK( bm_range< npl::segment_tree     < int, bm_pb_sum< int > > > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_range< npl::wide_segment_tree< int                   > > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( bm_range_batch< npl::segment_tree< int, bm_pb_sum< int > > > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+#endif
+
+#ifdef NPL_BENCH_BUILD
+BENCHMARK( bm_segtree_build<  int > )->ArgsProduct( { { 1 << 20, 1 << 24 }, { 1, 2, 4, 8 } } )->Unit( benchmark::kMillisecond )->UseRealTime();
+BENCHMARK( bm_segtree_build< long > )->ArgsProduct( { { 1 << 20, 1 << 24 }, { 1, 2, 4, 8 } } )->Unit( benchmark::kMillisecond )->UseRealTime();
+#endif
+
+#ifdef NPL_BENCH_REDUCERS
+BENCHMARK( bm_range< npl::segment_tree< int, bm_pb_sum< int >          > > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_range< npl::segment_tree< int, npl::reduce_sum< int >{} > > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_range< npl::segment_tree< int, bm_pb_min< int >          > > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_range< npl::segment_tree< int, npl::reduce_min< int >{} > > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+
+BENCHMARK( bm_segtree_build<   int, bm_pb_sum< int >          > )->ArgsProduct( { { 1 << 20, 1 << 24 }, { 1 } } )->Unit( benchmark::kMillisecond );
+BENCHMARK( bm_segtree_build<   int, npl::reduce_sum< int >{} > )->ArgsProduct( { { 1 << 20, 1 << 24 }, { 1 } } )->Unit( benchmark::kMillisecond );
+BENCHMARK( bm_segtree_build<   int, bm_pb_min< int >          > )->ArgsProduct( { { 1 << 20, 1 << 24 }, { 1 } } )->Unit( benchmark::kMillisecond );
+BENCHMARK( bm_segtree_build<   int, npl::reduce_min< int >{} > )->ArgsProduct( { { 1 << 20, 1 << 24 }, { 1 } } )->Unit( benchmark::kMillisecond );
+BENCHMARK( bm_segtree_build< float, npl::reduce_max< float >{} > )->ArgsProduct( { { 1 << 20, 1 << 24 }, { 1 } } )->Unit( benchmark::kMillisecond );
+#endif
+
+#ifdef NPL_BENCH_VIEW
+BENCHMARK( bm_view_build     < int > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_view_copy_build< int > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+#endif
+
+#ifdef NPL_BENCH_FENWICK_BUILD
+BENCHMARK( bm_fenwick_build<  int > )->RangeMultiplier( 16 )->Range( 1 << 12, 1 << 24 )->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_fenwick_build<  int > )->Arg( 100000000 )->Unit( benchmark::kMillisecond );
+BENCHMARK( bm_fenwick_build< long > )->RangeMultiplier( 16 )->Range( 1 << 12, 1 << 24 )->Unit( benchmark::kMicrosecond );
+#endif
+
+#ifdef NPL_BENCH_LOWER_BOUND
+BENCHMARK( bm_fenwick_lower_bound<  true > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_fenwick_lower_bound< false > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+#endif
+
+#ifdef NPL_BENCH_RANGE_ADD
+BENCHMARK( bm_range_add_query< npl::range_fenwick_tree< long > > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_range_add_query< bm_lazy_add_tree       < long > > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+#endif
+
+#ifdef NPL_BENCH_STATIC
+BENCHMARK( bm_small_build_query< npl::segment_tree       < int,     npl::reduce_min< int >{} > > );
+BENCHMARK( bm_small_build_query< npl::static_segment_tree< int, 64, npl::reduce_min< int >{} > > );
+BENCHMARK( bm_small_build_query< npl::fenwick_tree       < int                                > > );
+BENCHMARK( bm_small_build_query< npl::static_fenwick_tree< int, 64                            > > );
+#endif
+
+#ifdef NPL_BENCH_FENWICK_ND
+BENCHMARK( bm_fenwick_2d<  true > )->RangeMultiplier( 4 )->Range( 1 << 6, 1 << 12 )->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_fenwick_2d< false > )->RangeMultiplier( 4 )->Range( 1 << 6, 1 << 12 )->Unit( benchmark::kMicrosecond );
+#endif
+
+#ifdef NPL_BENCH_FENWICK_LAYOUT
+BENCHMARK( bm_fenwick_layout< bm_plain_fenwick        < long >,  true > )->RangeMultiplier( 16 )->Range( 1 << 12, 1 << 24 )->Arg( 12345678 )->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_fenwick_layout< npl::padded_fenwick_tree< long >,  true > )->RangeMultiplier( 16 )->Range( 1 << 12, 1 << 24 )->Arg( 12345678 )->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_fenwick_layout< bm_plain_fenwick        < long >, false > )->RangeMultiplier( 16 )->Range( 1 << 12, 1 << 24 )->Arg( 12345678 )->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_fenwick_layout< npl::padded_fenwick_tree< long >, false > )->RangeMultiplier( 16 )->Range( 1 << 12, 1 << 24 )->Arg( 12345678 )->Unit( benchmark::kMicrosecond );
+#endif
+
+#ifdef NPL_BENCH_ARGMIN
+BENCHMARK( bm_range_argmin      < int > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_range_argmin_pairs< int > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+#endif
+
+#ifdef NPL_BENCH_MULTI
+BENCHMARK( bm_multi_range   < int > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_separate_range< int > )->RangeMultiplier( 8 )->Range( 1 << 10, 1 << 24 )->Unit( benchmark::kMicrosecond );
+#endif
+
+#ifdef NPL_BENCH_CONCURRENT
+BENCHMARK( bm_concurrent_range< npl::concurrent_segment_tree< int, bm_pb_sum< int > > > )
+        ->Setup( bm_concurrent_fixture< npl::concurrent_segment_tree< int, bm_pb_sum< int > > >::setup )
+        ->Teardown( bm_concurrent_fixture< npl::concurrent_segment_tree< int, bm_pb_sum< int > > >::teardown )
+        ->Arg( 1 << 20 )->ThreadRange( 1, 32 )->UseRealTime()->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_concurrent_range< bm_locked_segment_tree< int > > )
+        ->Setup( bm_concurrent_fixture< bm_locked_segment_tree< int > >::setup )
+        ->Teardown( bm_concurrent_fixture< bm_locked_segment_tree< int > >::teardown )
+        ->Arg( 1 << 20 )->ThreadRange( 1, 32 )->UseRealTime()->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_concurrent_counters< npl::concurrent_fenwick_tree< long > > )
+        ->Setup( bm_counter_fixture< npl::concurrent_fenwick_tree< long > >::setup )
+        ->Teardown( bm_counter_fixture< npl::concurrent_fenwick_tree< long > >::teardown )
+        ->Arg( 1 << 20 )->ThreadRange( 1, 32 )->UseRealTime()->Unit( benchmark::kMicrosecond );
+BENCHMARK( bm_concurrent_counters< bm_locked_fenwick_tree< long > > )
+        ->Setup( bm_counter_fixture< bm_locked_fenwick_tree< long > >::setup )
+        ->Teardown( bm_counter_fixture< bm_locked_fenwick_tree< long > >::teardown )
+        ->Arg( 1 << 20 )->ThreadRange( 1, 32 )->UseRealTime()->Unit( benchmark::kMicrosecond );
+#endif
+
 #ifdef NPL_BENCH_EMPLACE_BACK
 BENCHMARK( bm_emplace_back< std::vector      < addable > > )->RangeMultiplier( 2 )->Range( 256, 256 << 8 )->Unit( benchmark::kMicrosecond );
 BENCHMARK( bm_emplace_back< npl::prefix_array< addable > > )->RangeMultiplier( 2 )->Range( 256, 256 << 8 )->Unit( benchmark::kMicrosecond );
@@ -11,6 +11,11 @@
 
 #include <natprolib>
 #include <vector>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
 
 
 namespace npl_bench
@@ -177,7 +182,7 @@ static void bm_push_back ( benchmark::State & state )
                 }
 
                 benchmark::ClobberMemory();
-                benchmark::DoNotOptimize( c );
+                benchmark::DoNotOptimize( c.data() );
         }
 }
 
@@ -235,11 +240,896 @@ static void bm_emplace_back ( [[ maybe_unused ]] benchmark::State & state )
         }
 }
 
+template< typename T >
+auto bm_pb_sum
+{
+        []( T const & lhs, T const & rhs )
+        {
+                return lhs + rhs;
+        }
+};
+
+template< typename T >
+auto bm_pb_min
+{
+        []( T const & lhs, T const & rhs )
+        {
+                return rhs < lhs ? rhs : lhs;
+        }
+};
+
+template< typename Container >
+static Container bm_make_range_container ( std::size_t const count )
+{
+        using value_type = typename Container::value_type;
+
+        npl::vector< value_type > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source.push_back( static_cast< value_type >( i % 128 ) );
+        }
+
+        return Container( source.begin(), source.end() );
+}
+
+static void bm_make_range_queries ( std::vector< std::size_t > & xs, std::vector< std::size_t > & ys, std::size_t const count )
+{
+        std::uint64_t seed = 0x9e3779b97f4a7c15ULL;
+
+        for( std::size_t i = 0; i < xs.size(); ++i )
+        {
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                std::size_t a = ( seed >> 17 ) % count;
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                std::size_t b = ( seed >> 17 ) % count;
+
+                xs[ i ] = a < b ? a : b;
+                ys[ i ] = a < b ? b : a;
+        }
+}
+
+template< typename Container >
+static void bm_range ( benchmark::State & state )
+{
+        using value_type = typename Container::value_type;
+
+        std::size_t const count   = state.range( 0 );
+        std::size_t const queries =             4096;
+
+        Container c = bm_make_range_container< Container >( count );
+
+        std::vector< std::size_t > xs( queries );
+        std::vector< std::size_t > ys( queries );
+
+        bm_make_range_queries( xs, ys, count );
+
+        for( auto _ : state )
+        {
+                value_type res = value_type();
+
+                for( std::size_t i = 0; i < queries; ++i )
+                {
+                        res += c.range( xs[ i ], ys[ i ] );
+                }
+
+                benchmark::DoNotOptimize( res );
+        }
+        state.SetItemsProcessed( state.iterations() * queries );
+}
+
+template< typename T, auto PB = bm_pb_sum< T > >
+static void bm_segtree_build ( benchmark::State & state )
+{
+        std::size_t const count   = state.range( 0 );
+        unsigned    const threads = static_cast< unsigned >( state.range( 1 ) );
+
+        npl::vector< T > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source.push_back( static_cast< T >( i % 128 ) );
+        }
+
+        npl::segment_tree< T, PB > c;
+
+        for( auto _ : state )
+        {
+                c.assign( npl::parallel_build_t{ threads }, source.begin(), source.end() );
+
+                benchmark::ClobberMemory();
+                benchmark::DoNotOptimize( c.data() );
+        }
+        state.SetItemsProcessed( state.iterations() * count );
+}
+
+template< typename Container >
+static void bm_range_batch ( benchmark::State & state )
+{
+        using value_type = typename Container::value_type;
+
+        std::size_t const count   = state.range( 0 );
+        std::size_t const queries =             4096;
+
+        Container c = bm_make_range_container< Container >( count );
+
+        std::vector< std::size_t > xs( queries );
+        std::vector< std::size_t > ys( queries );
+        std::vector< value_type  > rs( queries );
+
+        bm_make_range_queries( xs, ys, count );
+
+        for( auto _ : state )
+        {
+                c.range_batch( xs.data(), ys.data(), rs.data(), queries );
+
+                benchmark::ClobberMemory();
+                benchmark::DoNotOptimize( rs.data() );
+        }
+        state.SetItemsProcessed( state.iterations() * queries );
+}
+
+
+//
+//      building over leaves that already exist, segment_tree copies them in,
+//      segment_tree_view only allocates and fills the internal nodes
+//
+template< typename T >
+static void bm_view_build ( benchmark::State & state )
+{
+        std::size_t const count = state.range( 0 );
+
+        npl::vector< T > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source.push_back( static_cast< T >( i % 128 ) );
+        }
+
+        for( auto _ : state )
+        {
+                npl::segment_tree_view< T, npl::reduce_sum< T >{} > c( source.data(), count );
+
+                benchmark::ClobberMemory();
+                benchmark::DoNotOptimize( c.data() );
+        }
+        state.SetItemsProcessed( state.iterations() * count );
+}
+
+template< typename T >
+static void bm_view_copy_build ( benchmark::State & state )
+{
+        std::size_t const count = state.range( 0 );
+
+        npl::vector< T > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source.push_back( static_cast< T >( i % 128 ) );
+        }
+
+        for( auto _ : state )
+        {
+                npl::segment_tree< T, npl::reduce_sum< T >{} > c( source.begin(), source.end() );
+
+                benchmark::ClobberMemory();
+                benchmark::DoNotOptimize( c.data() );
+        }
+        state.SetItemsProcessed( state.iterations() * count );
+}
+
+template< typename T >
+static void bm_fenwick_build ( benchmark::State & state )
+{
+        std::size_t const count = state.range( 0 );
+
+        npl::vector< T > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source.push_back( static_cast< T >( i % 128 ) );
+        }
+
+        for( auto _ : state )
+        {
+                npl::fenwick_tree< T > c( source.data(), source.data() + count );
+
+                benchmark::ClobberMemory();
+                benchmark::DoNotOptimize( c.data() );
+        }
+        state.SetItemsProcessed( state.iterations() * count );
+}
+
+//
+//      smallest index with prefix sum >= s, by binary lifting or by
+//      binary search over range( 0, mid )
+//
+template< bool Lifting >
+static void bm_fenwick_lower_bound ( benchmark::State & state )
+{
+        std::size_t const count   = state.range( 0 );
+        std::size_t const queries =             4096;
+
+        npl::vector< long > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source.push_back( static_cast< long >( ( i * 7919 ) % 16 ) );
+        }
+
+        npl::fenwick_tree< long > c( source.data(), source.data() + count );
+
+        long const total = c.range();
+
+        std::vector< long > sums( queries );
+
+        for( std::size_t i = 0; i < queries; ++i )
+        {
+                sums[ i ] = static_cast< long >( ( i * 2654435761u ) % static_cast< std::size_t >( total ) ) + 1;
+        }
+
+        for( auto _ : state )
+        {
+                std::size_t res = 0;
+
+                for( std::size_t i = 0; i < queries; ++i )
+                {
+                        if constexpr( Lifting )
+                        {
+                                res += c.lower_bound_prefix( sums[ i ] );
+                        }
+                        else
+                        {
+                                std::size_t lo = 0;
+                                std::size_t hi = count;
+
+                                while( lo < hi )
+                                {
+                                        std::size_t const mid = lo + ( hi - lo ) / 2;
+
+                                        if( c.range( 0, mid ) < sums[ i ] )
+                                        {
+                                                lo = mid + 1;
+                                        }
+                                        else
+                                        {
+                                                hi = mid;
+                                        }
+                                }
+                                res += lo;
+                        }
+                }
+                benchmark::DoNotOptimize( res );
+        }
+        state.SetItemsProcessed( state.iterations() * queries );
+}
+
+template< typename T >
+struct _bm_tb_add
+{
+        T operator() ( T const & node, T const & tag, std::size_t len ) const
+        {
+                return node + tag * static_cast< T >( len );
+        }
+
+        T operator() ( T const & old, T const & tag ) const
+        {
+                return old + tag;
+        }
+};
+
+template< typename T >
+auto bm_tb_add{ _bm_tb_add< T >{} };
+
+//
+//      interleaved range additions and range sums
+//
+template< typename Container >
+static void bm_range_add_query ( benchmark::State & state )
+{
+        std::size_t const count   = state.range( 0 );
+        std::size_t const queries =             4096;
+
+        npl::vector< long > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source.push_back( static_cast< long >( i % 128 ) );
+        }
+
+        Container c( source.begin(), source.end() );
+
+        std::vector< std::size_t > xs( queries );
+        std::vector< std::size_t > ys( queries );
+
+        for( std::size_t i = 0; i < queries; ++i )
+        {
+                std::size_t const a = ( i * 7919  ) % count;
+                std::size_t const b = ( i * 10007 ) % count;
+
+                xs[ i ] = a < b ? a : b;
+                ys[ i ] = a < b ? b : a;
+        }
+
+        for( auto _ : state )
+        {
+                long res = 0;
+
+                for( std::size_t i = 0; i < queries; ++i )
+                {
+                        if( i % 2 == 0 )
+                        {
+                                c.add( xs[ i ], ys[ i ], 3 );
+                        }
+                        else
+                        {
+                                res += c.range( xs[ i ], ys[ i ] );
+                        }
+                }
+                benchmark::DoNotOptimize( res );
+        }
+        state.SetItemsProcessed( state.iterations() * queries );
+}
+
+template< typename T >
+class bm_lazy_add_tree
+        : public npl::lazy_segment_tree< T, bm_pb_sum< T >, bm_tb_add< T > >
+{
+        using _base = npl::lazy_segment_tree< T, bm_pb_sum< T >, bm_tb_add< T > >;
+public:
+        using _base::_base;
+
+        void add ( std::size_t const x, std::size_t const y, T const & val )
+        {
+                this->update( x, y, val );
+        }
+};
+
+//
+//      short lived small trees, built from 64 values and queried once,
+//      the heap tree pays an allocation per build, the static one lives on the stack
+//
+template< typename Container >
+static void bm_small_build_query ( benchmark::State & state )
+{
+        constexpr std::size_t count = 64;
+
+        int source[ count ];
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source[ i ] = static_cast< int >( ( i * 7919 ) % 1024 );
+        }
+
+        std::size_t x = 0;
+
+        for( auto _ : state )
+        {
+                Container c( source, source + count );
+
+                benchmark::DoNotOptimize( c.range( x, count - 1 ) );
+
+                x = ( x + 1 ) % count;
+        }
+        state.SetItemsProcessed( state.iterations() );
+}
+
+
+//
+//      fenwick tree in the plain layout, node k - 1 at offset k - 1,
+//      otherwise the same code as padded_fenwick_tree
+//
+template< typename T >
+class bm_plain_fenwick
+{
+public:
+        explicit bm_plain_fenwick ( std::size_t const count ) : data_( count ) {}
+
+        void add ( std::size_t i, T const & val )
+        {
+                for( ++i; i <= data_.size(); i += i & -i )
+                {
+                        data_[ i - 1 ] += val;
+                }
+        }
+
+        T range ( std::size_t const x, std::size_t const y ) const
+        {
+                return x == 0 ? prefix( y ) : prefix( y ) - prefix( x - 1 );
+        }
+
+private:
+        std::vector< T > data_;
+
+        T prefix ( std::size_t i ) const
+        {
+                T res{};
+
+                for( ++i; i > 0; i -= i & -i )
+                {
+                        res += data_[ i - 1 ];
+                }
+                return res;
+        }
+};
+
+//
+//      random point adds, then random prefix queries, the counters example from
+//      the request is a 2^24 tree of longs, odd sizes show the layout is no worse
+//
+template< typename Container, bool Update >
+static void bm_fenwick_layout ( benchmark::State & state )
+{
+        std::size_t const count   = state.range( 0 );
+        std::size_t const queries =             4096;
+
+        Container c( count );
+
+        std::vector< std::size_t > xs( queries );
+        std::vector< std::size_t > ys( queries );
+
+        bm_make_range_queries( xs, ys, count );
+
+        for( auto _ : state )
+        {
+                long res = 0;
+
+                for( std::size_t i = 0; i < queries; ++i )
+                {
+                        if constexpr( Update )
+                        {
+                                c.add( xs[ i ], 1 );
+                        }
+                        else
+                        {
+                                res += c.range( 0, ys[ i ] );
+                        }
+                }
+                benchmark::DoNotOptimize( res );
+                benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed( state.iterations() * queries );
+}
+//
+//      textbook 2D fenwick tree, one heap row per tree row and the
+//      index arithmetic redone in the inner loop
+//
+template< typename T >
+class bm_nested_fenwick_2d
+{
+public:
+        bm_nested_fenwick_2d ( std::size_t const rows, std::size_t const cols )
+                : data_( rows, std::vector< T >( cols ) ) {}
+
+        void add ( std::size_t const r, std::size_t const c, T const & val )
+        {
+                for( std::size_t i = r + 1; i <= data_.size(); i += i & -i )
+                {
+                        for( std::size_t j = c + 1; j <= data_[ i - 1 ].size(); j += j & -j )
+                        {
+                                data_[ i - 1 ][ j - 1 ] += val;
+                        }
+                }
+        }
+
+        T prefix ( std::size_t const r, std::size_t const c ) const
+        {
+                T res{};
+
+                for( std::size_t i = r + 1; i > 0; i -= i & -i )
+                {
+                        for( std::size_t j = c + 1; j > 0; j -= j & -j )
+                        {
+                                res += data_[ i - 1 ][ j - 1 ];
+                        }
+                }
+                return res;
+        }
+
+        T range ( std::size_t const r0, std::size_t const c0, std::size_t const r1, std::size_t const c1 ) const
+        {
+                T res = prefix( r1, c1 );
+
+                if( r0 > 0           ) res -= prefix( r0 - 1, c1     );
+                if( c0 > 0           ) res -= prefix( r1    , c0 - 1 );
+                if( r0 > 0 && c0 > 0 ) res += prefix( r0 - 1, c0 - 1 );
+
+                return res;
+        }
+
+private:
+        std::vector< std::vector< T > > data_;
+};
+
+//
+//      n x n grid, alternating point adds and box queries
+//
+template< bool Flat >
+static void bm_fenwick_2d ( benchmark::State & state )
+{
+        std::size_t const n       = state.range( 0 );
+        std::size_t const queries =             4096;
+
+        using tree_type = std::conditional_t< Flat, npl::fenwick_tree_nd< long, 2 >, bm_nested_fenwick_2d< long > >;
+
+        tree_type c = [ & ]
+        {
+                if constexpr( Flat ) { return tree_type( { n, n } ); }
+                else                 { return tree_type(   n, n   ); }
+        }();
+
+        std::vector< std::size_t > xs( queries );
+        std::vector< std::size_t > ys( queries );
+
+        bm_make_range_queries( xs, ys, n );
+
+        for( auto _ : state )
+        {
+                long res = 0;
+
+                for( std::size_t i = 0; i < queries; ++i )
+                {
+                        std::size_t const j = ( i * 31 ) % queries;
+
+                        if constexpr( Flat )
+                        {
+                                if( i % 2 == 0 ) c.add( { xs[ i ], ys[ j ] }, 3 );
+                                else             res += c.range( { xs[ i ], xs[ j ] }, { ys[ i ], ys[ j ] } );
+                        }
+                        else
+                        {
+                                if( i % 2 == 0 ) c.add( xs[ i ], ys[ j ], 3 );
+                                else             res += c.range( xs[ i ], xs[ j ], ys[ i ], ys[ j ] );
+                        }
+                }
+                benchmark::DoNotOptimize( res );
+        }
+        state.SetItemsProcessed( state.iterations() * queries );
+}
+
+//
+//      position of the range minimum, from a reduce_min tree of plain values
+//      or from a tree of ( value, index ) pairs twice the node size
+//
+template< typename T >
+static void bm_range_argmin ( benchmark::State & state )
+{
+        std::size_t const count   = state.range( 0 );
+        std::size_t const queries =             4096;
+
+        npl::vector< T > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source.push_back( static_cast< T >( ( i * 7919 ) % 1024 ) );
+        }
+
+        npl::segment_tree< T, npl::reduce_min< T >{} > c( source.begin(), source.end() );
+
+        std::vector< std::size_t > xs( queries );
+        std::vector< std::size_t > ys( queries );
+
+        bm_make_range_queries( xs, ys, count );
+
+        for( auto _ : state )
+        {
+                std::size_t res = 0;
+
+                for( std::size_t i = 0; i < queries; ++i )
+                {
+                        res += c.range_argmin( xs[ i ], ys[ i ] );
+                }
+
+                benchmark::DoNotOptimize( res );
+        }
+        state.SetItemsProcessed( state.iterations() * queries );
+}
+
+template< typename T >
+auto bm_pb_min_pair
+{
+        []( std::pair< T, std::size_t > const & lhs, std::pair< T, std::size_t > const & rhs )
+        {
+                return rhs < lhs ? rhs : lhs;
+        }
+};
+
+template< typename T >
+static void bm_range_argmin_pairs ( benchmark::State & state )
+{
+        using pair = std::pair< T, std::size_t >;
+
+        std::size_t const count   = state.range( 0 );
+        std::size_t const queries =             4096;
+
+        npl::vector< pair > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source.push_back( pair( static_cast< T >( ( i * 7919 ) % 1024 ), i ) );
+        }
+
+        npl::segment_tree< pair, bm_pb_min_pair< T > > c( source.begin(), source.end() );
+
+        std::vector< std::size_t > xs( queries );
+        std::vector< std::size_t > ys( queries );
+
+        bm_make_range_queries( xs, ys, count );
+
+        for( auto _ : state )
+        {
+                std::size_t res = 0;
+
+                for( std::size_t i = 0; i < queries; ++i )
+                {
+                        res += c.range( xs[ i ], ys[ i ] ).second;
+                }
+
+                benchmark::DoNotOptimize( res );
+        }
+        state.SetItemsProcessed( state.iterations() * queries );
+}
+
+//
+//      sum, min and max of the same ranges, from one multi_segment_tree
+//      or from three segment_trees queried back to back
+//
+template< typename T >
+static void bm_multi_range ( benchmark::State & state )
+{
+        using Container = npl::multi_segment_tree< T, npl::reduce_sum< T >, npl::reduce_min< T >, npl::reduce_max< T > >;
+
+        std::size_t const count   = state.range( 0 );
+        std::size_t const queries =             4096;
+
+        Container c = bm_make_range_container< Container >( count );
+
+        std::vector< std::size_t > xs( queries );
+        std::vector< std::size_t > ys( queries );
+
+        bm_make_range_queries( xs, ys, count );
+
+        for( auto _ : state )
+        {
+                T res = T();
+
+                for( std::size_t i = 0; i < queries; ++i )
+                {
+                        auto r = c.range( xs[ i ], ys[ i ] );
+
+                        res += r[ 0 ] + r[ 1 ] + r[ 2 ];
+                }
+
+                benchmark::DoNotOptimize( res );
+        }
+        state.SetItemsProcessed( state.iterations() * queries );
+}
+
+template< typename T >
+static void bm_separate_range ( benchmark::State & state )
+{
+        std::size_t const count   = state.range( 0 );
+        std::size_t const queries =             4096;
+
+        auto sums = bm_make_range_container< npl::segment_tree< T, npl::reduce_sum< T >{} > >( count );
+        auto mins = bm_make_range_container< npl::segment_tree< T, npl::reduce_min< T >{} > >( count );
+        auto maxs = bm_make_range_container< npl::segment_tree< T, npl::reduce_max< T >{} > >( count );
+
+        std::vector< std::size_t > xs( queries );
+        std::vector< std::size_t > ys( queries );
+
+        bm_make_range_queries( xs, ys, count );
+
+        for( auto _ : state )
+        {
+                T res = T();
+
+                for( std::size_t i = 0; i < queries; ++i )
+                {
+                        res += sums.range( xs[ i ], ys[ i ] ) + mins.range( xs[ i ], ys[ i ] ) + maxs.range( xs[ i ], ys[ i ] );
+                }
+
+                benchmark::DoNotOptimize( res );
+        }
+        state.SetItemsProcessed( state.iterations() * queries );
+}
+
+//
+//      what concurrent_segment_tree replaces, a segment_tree behind a shared_mutex
+//
+template< typename T >
+class bm_locked_segment_tree
+{
+public:
+        using value_type = T;
+
+        template< typename Iter >
+        bm_locked_segment_tree ( Iter first, Iter last ) : tree_( first, last ) {}
+
+        T range ( std::size_t const x, std::size_t const y ) const
+        {
+                std::shared_lock lock( mutex_ );
+                return tree_.range( x, y );
+        }
+
+        void update ( std::size_t const pos, T const & val )
+        {
+                std::unique_lock lock( mutex_ );
+                tree_.update( pos, val );
+        }
+
+private:
+        mutable std::shared_mutex               mutex_ ;
+        npl::segment_tree< T, bm_pb_sum< T > >  tree_  ;
+};
+
+//
+//      one writer updating in a loop for the whole run, readers are the benchmark threads,
+//      the writer's throughput is reported too since a lock that favours readers starves it
+//
+template< typename Container >
+struct bm_concurrent_fixture
+{
+        static inline std::unique_ptr< Container > tree   ;
+        static inline std::atomic< bool >          stop   ;
+        static inline std::atomic< std::size_t >   writes ;
+        static inline std::thread                  writer ;
+
+        static void setup ( benchmark::State const & state )
+        {
+                using value_type = typename Container::value_type;
+
+                std::size_t const count = state.range( 0 );
+
+                npl::vector< value_type > source;
+
+                for( std::size_t i = 0; i < count; ++i )
+                {
+                        source.push_back( static_cast< value_type >( i % 128 ) );
+                }
+                tree = std::make_unique< Container >( source.begin(), source.end() );
+
+                stop  .store( false );
+                writes.store(     0 );
+
+                writer = std::thread( [ count ]
+                {
+                        std::size_t i = 0;
+
+                        while( !stop.load( std::memory_order_relaxed ) )
+                        {
+                                tree->update( ( i * 7919 ) % count, static_cast< value_type >( i % 128 ) );
+                                writes.store( ++i, std::memory_order_relaxed );
+                        }
+                } );
+        }
+
+        static void teardown ( benchmark::State const & )
+        {
+                stop.store( true );
+                writer.join();
+                tree.reset();
+        }
+};
+
 template< typename Container >
-static void bm_range ( [[ maybe_unused ]] benchmark::State & state )
+static void bm_concurrent_range ( benchmark::State & state )
 {
+        using value_type = typename Container::value_type;
+
+        std::size_t const count   = state.range( 0 );
+        std::size_t const queries =             4096;
 
+        std::vector< std::size_t > xs( queries );
+        std::vector< std::size_t > ys( queries );
+
+        bm_make_range_queries( xs, ys, count );
+
+        Container const & c = *bm_concurrent_fixture< Container >::tree;
+
+        std::size_t const writes = bm_concurrent_fixture< Container >::writes.load();
+
+        for( auto _ : state )
+        {
+                value_type res = value_type();
+
+                for( std::size_t i = 0; i < queries; ++i )
+                {
+                        res += c.range( xs[ i ], ys[ i ] );
+                }
+
+                benchmark::DoNotOptimize( res );
+        }
+        state.SetItemsProcessed( state.iterations() * queries );
+
+        if( state.thread_index() == 0 )
+        {
+                state.counters[ "writes" ] = benchmark::Counter( static_cast< double >( bm_concurrent_fixture< Container >::writes.load() - writes ),
+                                                                 benchmark::Counter::kIsRate );
+        }
 }
 
+//
+//      what concurrent_fenwick_tree replaces, a fenwick tree behind a mutex
+//
+template< typename T >
+class bm_locked_fenwick_tree
+{
+public:
+        using value_type = T;
+
+        explicit bm_locked_fenwick_tree ( std::size_t const count ) : tree_( count ) {}
+
+        void add ( std::size_t const pos, T const & val )
+        {
+                std::lock_guard lock( mutex_ );
+                tree_.add( pos, val );
+        }
+
+        T range ( std::size_t const x, std::size_t const y ) const
+        {
+                std::lock_guard lock( mutex_ );
+                return tree_.range( x, y );
+        }
+
+private:
+        mutable std::mutex       mutex_ ;
+        bm_plain_fenwick< T >    tree_  ;
+};
+
+template< typename Container >
+struct bm_counter_fixture
+{
+        static inline std::unique_ptr< Container > tree ;
+
+        static void setup ( benchmark::State const & state )
+        {
+                tree = std::make_unique< Container >( static_cast< std::size_t >( state.range( 0 ) ) );
+        }
+
+        static void teardown ( benchmark::State const & )
+        {
+                tree.reset();
+        }
+};
+
+//
+//      every benchmark thread is a worker bumping counters,
+//      one operation in 16 is a prefix query
+//
+template< typename Container >
+static void bm_concurrent_counters ( benchmark::State & state )
+{
+        std::size_t const count   = state.range( 0 );
+        std::size_t const queries =             4096;
+
+        std::vector< std::size_t > xs( queries );
+        std::vector< std::size_t > ys( queries );
+
+        bm_make_range_queries( xs, ys, count );
+
+        Container & c = *bm_counter_fixture< Container >::tree;
+
+        for( auto _ : state )
+        {
+                long res = 0;
+
+                for( std::size_t i = 0; i < queries; ++i )
+                {
+                        if( i % 16 == 15 )
+                        {
+                                res += c.range( 0, ys[ i ] );
+                        }
+                        else
+                        {
+                                c.add( xs[ i ], 1 );
+                        }
+                }
+                benchmark::DoNotOptimize( res );
+        }
+        state.SetItemsProcessed( state.iterations() * queries );
+}
+
+
 
 } // namespace npl_bench
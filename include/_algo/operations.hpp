@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <limits>
+
 #include <util.hpp>
+#include <_traits/base_traits.hpp>
 
 
 namespace npl
@@ -54,5 +57,159 @@ struct less< void >
                 {  return           NPL_FWD( _lhs_ ) < NPL_FWD( _rhs_ ) ; }
 };
 
+//=====================================================================
+//      reducers
+//=====================================================================
+//
+//      binary operations usable as segment tree parent builders
+//      which also know their own identity element
+//
+//      every reducer states whether it is associative, commutative and idempotent,
+//      containers check reducer_traits at compile time and switch to branch free
+//      and vectorized kernels for the ones they recognize
+//
+
+template< typename T >
+struct reduce_sum
+        : _binary_function< T, T, T >
+{
+        static constexpr bool associative = true  ;
+        static constexpr bool commutative = true  ;
+        static constexpr bool  idempotent = false ;
+
+        NPL_NODISCARD static constexpr T identity () noexcept
+        { return T(); }
+
+        inline constexpr T operator() ( T const & _lhs_, T const & _rhs_ ) const
+        { return _lhs_ + _rhs_; }
+};
+
+template< typename T >
+struct reduce_min
+        : _binary_function< T, T, T >
+{
+        static constexpr bool associative = true ;
+        static constexpr bool commutative = true ;
+        static constexpr bool  idempotent = true ;
+
+        NPL_NODISCARD static constexpr T identity () noexcept
+        { return std::numeric_limits< T >::has_infinity ? std::numeric_limits< T >::infinity() : std::numeric_limits< T >::max(); }
+
+        inline constexpr T operator() ( T const & _lhs_, T const & _rhs_ ) const
+        { return _rhs_ < _lhs_ ? _rhs_ : _lhs_; }
+};
+
+template< typename T >
+struct reduce_max
+        : _binary_function< T, T, T >
+{
+        static constexpr bool associative = true ;
+        static constexpr bool commutative = true ;
+        static constexpr bool  idempotent = true ;
+
+        NPL_NODISCARD static constexpr T identity () noexcept
+        { return std::numeric_limits< T >::has_infinity ? -std::numeric_limits< T >::infinity() : std::numeric_limits< T >::lowest(); }
+
+        inline constexpr T operator() ( T const & _lhs_, T const & _rhs_ ) const
+        { return _lhs_ < _rhs_ ? _rhs_ : _lhs_; }
+};
+
+template< typename T >
+struct reduce_xor
+        : _binary_function< T, T, T >
+{
+        static constexpr bool associative = true  ;
+        static constexpr bool commutative = true  ;
+        static constexpr bool  idempotent = false ;
+
+        NPL_NODISCARD static constexpr T identity () noexcept
+        { return T(); }
+
+        inline constexpr T operator() ( T const & _lhs_, T const & _rhs_ ) const
+        { return _lhs_ ^ _rhs_; }
+};
+
+//
+//      gcd( 0, x ) == x, so 0 is the identity, negative values are reduced by magnitude
+//
+template< typename T >
+struct reduce_gcd
+        : _binary_function< T, T, T >
+{
+        static constexpr bool associative = true ;
+        static constexpr bool commutative = true ;
+        static constexpr bool  idempotent = true ;
+
+        NPL_NODISCARD static constexpr T identity () noexcept
+        { return T(); }
+
+        inline constexpr T operator() ( T _lhs_, T _rhs_ ) const
+        {
+                _lhs_ = _lhs_ < T() ? -_lhs_ : _lhs_;
+                _rhs_ = _rhs_ < T() ? -_rhs_ : _rhs_;
+
+                while( _rhs_ != T() )
+                {
+                        T rem = _lhs_ % _rhs_;
+
+                        _lhs_ = _rhs_;
+                        _rhs_ = rem;
+                }
+                return _lhs_;
+        }
+};
+
+//=====================================================================
+//      reducer_traits
+//=====================================================================
+//
+//      is_reducer is true for function objects providing a static identity()
+//      and the three algebraic flags, anything else, lambdas included,
+//      is treated as an opaque binary operation with T() as its identity
+//
+
+template< typename R, typename = void >
+struct _is_reducer_impl : false_type {} ;
+
+template< typename R >
+struct _is_reducer_impl<
+                        R,
+                        typename void_t< decltype( R::identity() ), decltype( R::associative ),
+                                         decltype( R::commutative ), decltype( R::idempotent ) >::type
+                       >
+                       : true_type {} ;
+
+template< typename R >
+struct is_reducer : _is_reducer_impl< remove_cvref_t< R > > {} ;
+
+template< typename R >
+inline constexpr bool is_reducer_v = is_reducer< R >::value ;
+
+template< typename R, typename T, bool = is_reducer_v< R > >
+struct reducer_traits
+{
+        static constexpr bool       known = false ;
+        static constexpr bool associative = true  ;
+        static constexpr bool commutative = false ;
+        static constexpr bool  idempotent = false ;
+
+        NPL_NODISCARD static constexpr T identity () noexcept
+        { return T(); }
+};
+
+template< typename R, typename T >
+struct reducer_traits< R, T, true >
+{
+        using _reducer = remove_cvref_t< R > ;
+
+        static constexpr bool       known = true                  ;
+        static constexpr bool associative = _reducer::associative ;
+        static constexpr bool commutative = _reducer::commutative ;
+        static constexpr bool  idempotent = _reducer::idempotent  ;
+
+        NPL_NODISCARD static constexpr T identity () noexcept
+        { return _reducer::identity(); }
+};
+
 
 } // namespace npl
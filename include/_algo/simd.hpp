@@ -0,0 +1,303 @@
+//
+//
+//      natprolib
+//      simd.hpp
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <util.hpp>
+#include <_traits/npl_traits.hpp>
+#include <_algo/operations.hpp>
+
+#if defined( __AVX2__ )
+#include <immintrin.h>
+#endif
+
+
+namespace npl
+{
+
+
+//=====================================================================
+//      cache line wide block reduction
+//=====================================================================
+//
+//      reduces the lanes [ lo, hi ) of a block of B elements starting at
+//      a NPL_CACHELINE_SIZE aligned address, lanes outside the window are
+//      replaced with the reducer's identity so the whole block is always
+//      read with no data dependent branches
+//
+//      the generic path is written so that the compiler can vectorize it,
+//      int and float sum / min / max get hand written AVX2 kernels
+//
+
+template< typename T, typename Reducer, std::size_t B >
+NPL_ALWAYS_INLINE inline
+T _block_reduce_generic ( T const * _block_, std::size_t const _lo_, std::size_t const _hi_ ) noexcept
+{
+        Reducer reducer;
+
+        T res = Reducer::identity();
+
+        for( std::size_t i = 0; i < B; ++i )
+        {
+                T val = ( i >= _lo_ && i < _hi_ ) ? _block_[ i ] : Reducer::identity();
+
+                res = reducer( res, val );
+        }
+        return res;
+}
+
+#if defined( __AVX2__ )
+
+NPL_ALWAYS_INLINE inline
+__m256i _block_mask_epi32 ( int const _offset_, std::size_t const _lo_, std::size_t const _hi_ ) noexcept
+{
+        __m256i idx = _mm256_add_epi32( _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ), _mm256_set1_epi32( _offset_ ) );
+
+        __m256i above_lo = _mm256_cmpgt_epi32( idx, _mm256_set1_epi32( static_cast< int >( _lo_ ) - 1 ) );
+        __m256i below_hi = _mm256_cmpgt_epi32( _mm256_set1_epi32( static_cast< int >( _hi_ ) ), idx );
+
+        return _mm256_and_si256( above_lo, below_hi );
+}
+
+template< typename Reducer >
+NPL_ALWAYS_INLINE inline
+__m256i _combine_epi32 ( __m256i const _lhs_, __m256i const _rhs_ ) noexcept
+{
+        if constexpr( is_same_v< Reducer, reduce_sum< std::int32_t > > ) return _mm256_add_epi32( _lhs_, _rhs_ );
+        else if constexpr( is_same_v< Reducer, reduce_min< std::int32_t > > ) return _mm256_min_epi32( _lhs_, _rhs_ );
+        else if constexpr( is_same_v< Reducer, reduce_xor< std::int32_t > > ) return _mm256_xor_si256( _lhs_, _rhs_ );
+        else                                                                  return _mm256_max_epi32( _lhs_, _rhs_ );
+}
+
+template< typename Reducer >
+NPL_ALWAYS_INLINE inline
+__m256 _combine_ps ( __m256 const _lhs_, __m256 const _rhs_ ) noexcept
+{
+        if constexpr( is_same_v< Reducer, reduce_sum< float > > ) return _mm256_add_ps( _lhs_, _rhs_ );
+        else if constexpr( is_same_v< Reducer, reduce_min< float > > ) return _mm256_min_ps( _lhs_, _rhs_ );
+        else                                                           return _mm256_max_ps( _lhs_, _rhs_ );
+}
+
+template< typename Reducer >
+NPL_ALWAYS_INLINE inline
+std::int32_t _block_reduce_epi32 ( std::int32_t const * _block_, std::size_t const _lo_, std::size_t const _hi_ ) noexcept
+{
+        __m256i id = _mm256_set1_epi32( Reducer::identity() );
+
+        __m256i lo = _mm256_load_si256( reinterpret_cast< __m256i const * >( _block_     ) );
+        __m256i hi = _mm256_load_si256( reinterpret_cast< __m256i const * >( _block_ + 8 ) );
+
+        lo = _mm256_blendv_epi8( id, lo, _block_mask_epi32( 0, _lo_, _hi_ ) );
+        hi = _mm256_blendv_epi8( id, hi, _block_mask_epi32( 8, _lo_, _hi_ ) );
+
+        __m256i v8 = _combine_epi32< Reducer >( lo, hi );
+        __m256i v4 = _combine_epi32< Reducer >( v8, _mm256_permute2x128_si256( v8, v8, 0x01 ) );
+        __m256i v2 = _combine_epi32< Reducer >( v4, _mm256_shuffle_epi32( v4, 0x4e ) );
+        __m256i v1 = _combine_epi32< Reducer >( v2, _mm256_shuffle_epi32( v2, 0xb1 ) );
+
+        return _mm256_cvtsi256_si32( v1 );
+}
+
+template< typename Reducer >
+NPL_ALWAYS_INLINE inline
+float _block_reduce_ps ( float const * _block_, std::size_t const _lo_, std::size_t const _hi_ ) noexcept
+{
+        __m256 id = _mm256_set1_ps( Reducer::identity() );
+
+        __m256 lo = _mm256_load_ps( _block_     );
+        __m256 hi = _mm256_load_ps( _block_ + 8 );
+
+        lo = _mm256_blendv_ps( id, lo, _mm256_castsi256_ps( _block_mask_epi32( 0, _lo_, _hi_ ) ) );
+        hi = _mm256_blendv_ps( id, hi, _mm256_castsi256_ps( _block_mask_epi32( 8, _lo_, _hi_ ) ) );
+
+        __m256 v8 = _combine_ps< Reducer >( lo, hi );
+        __m256 v4 = _combine_ps< Reducer >( v8, _mm256_permute2f128_ps( v8, v8, 0x01 ) );
+        __m256 v2 = _combine_ps< Reducer >( v4, _mm256_shuffle_ps( v4, v4, 0x4e ) );
+        __m256 v1 = _combine_ps< Reducer >( v2, _mm256_shuffle_ps( v2, v2, 0xb1 ) );
+
+        return _mm256_cvtss_f32( v1 );
+}
+
+#endif // __AVX2__
+
+template< typename T, typename Reducer >
+inline constexpr bool _has_simd_block_reduce_v =
+#if defined( __AVX2__ )
+        ( ( is_same_v< T, std::int32_t > || is_same_v< T, float > ) &&
+          ( is_same_v< Reducer, reduce_sum< T > > ||
+            is_same_v< Reducer, reduce_min< T > > ||
+            is_same_v< Reducer, reduce_max< T > > ) ) ||
+        ( is_same_v< T, std::int32_t > && is_same_v< Reducer, reduce_xor< T > > );
+#else
+        false;
+#endif
+
+template< typename T, typename Reducer, std::size_t B >
+NPL_ALWAYS_INLINE inline
+T _block_reduce ( T const * _block_, std::size_t const _lo_, std::size_t const _hi_ ) noexcept
+{
+#if defined( __AVX2__ )
+        if constexpr( _has_simd_block_reduce_v< T, Reducer > && B * sizeof( T ) == 64 )
+        {
+                if constexpr( is_same_v< T, float > ) return _block_reduce_ps   < Reducer >( _block_, _lo_, _hi_ );
+                else                                  return _block_reduce_epi32< Reducer >( _block_, _lo_, _hi_ );
+        }
+        else
+#endif
+        {
+                return _block_reduce_generic< T, Reducer, B >( _block_, _lo_, _hi_ );
+        }
+}
+
+//=====================================================================
+//      pairwise level reduction
+//=====================================================================
+//
+//      _dst_[ i ] = Reducer()( _src_[ 2 * i ], _src_[ 2 * i + 1 ] ) for i in [ 0, _count_ ),
+//      which is one level of an iterative segment tree built from the level below
+//
+//      the AVX2 kernels split sixteen children into even and odd lanes, combine them
+//      and fix up the 128 bit lane order, eight parents per iteration, unaligned
+//
+
+template< typename T, typename Reducer >
+NPL_ALWAYS_INLINE inline
+void _reduce_pairs_generic ( T * _dst_, T const * _src_, std::size_t const _count_ ) noexcept
+{
+        Reducer reducer;
+
+        for( std::size_t i = 0; i < _count_; ++i )
+        {
+                _dst_[ i ] = reducer( _src_[ 2 * i ], _src_[ 2 * i + 1 ] );
+        }
+}
+
+#if defined( __AVX2__ )
+
+template< typename Reducer >
+NPL_ALWAYS_INLINE inline
+void _reduce_pairs_ps ( float * _dst_, float const * _src_, std::size_t const _count_ ) noexcept
+{
+        std::size_t i = 0;
+
+        for( ; i + 8 <= _count_; i += 8 )
+        {
+                __m256 lo = _mm256_loadu_ps( _src_ + 2 * i     );
+                __m256 hi = _mm256_loadu_ps( _src_ + 2 * i + 8 );
+
+                __m256 res = _combine_ps< Reducer >( _mm256_shuffle_ps( lo, hi, 0x88 ), _mm256_shuffle_ps( lo, hi, 0xdd ) );
+
+                _mm256_storeu_ps( _dst_ + i, _mm256_castpd_ps( _mm256_permute4x64_pd( _mm256_castps_pd( res ), 0xd8 ) ) );
+        }
+        _reduce_pairs_generic< float, Reducer >( _dst_ + i, _src_ + 2 * i, _count_ - i );
+}
+
+template< typename Reducer >
+NPL_ALWAYS_INLINE inline
+void _reduce_pairs_epi32 ( std::int32_t * _dst_, std::int32_t const * _src_, std::size_t const _count_ ) noexcept
+{
+        std::size_t i = 0;
+
+        for( ; i + 8 <= _count_; i += 8 )
+        {
+                __m256 lo = _mm256_castsi256_ps( _mm256_loadu_si256( reinterpret_cast< __m256i const * >( _src_ + 2 * i     ) ) );
+                __m256 hi = _mm256_castsi256_ps( _mm256_loadu_si256( reinterpret_cast< __m256i const * >( _src_ + 2 * i + 8 ) ) );
+
+                __m256i res = _combine_epi32< Reducer >( _mm256_castps_si256( _mm256_shuffle_ps( lo, hi, 0x88 ) ),
+                                                         _mm256_castps_si256( _mm256_shuffle_ps( lo, hi, 0xdd ) ) );
+
+                _mm256_storeu_si256( reinterpret_cast< __m256i * >( _dst_ + i ), _mm256_permute4x64_epi64( res, 0xd8 ) );
+        }
+        _reduce_pairs_generic< std::int32_t, Reducer >( _dst_ + i, _src_ + 2 * i, _count_ - i );
+}
+
+#endif // __AVX2__
+
+template< typename T, typename Reducer >
+NPL_ALWAYS_INLINE inline
+void _reduce_pairs ( T * _dst_, T const * _src_, std::size_t const _count_ ) noexcept
+{
+#if defined( __AVX2__ )
+        if constexpr( _has_simd_block_reduce_v< T, Reducer > )
+        {
+                if constexpr( is_same_v< T, float > ) _reduce_pairs_ps   < Reducer >( _dst_, _src_, _count_ );
+                else                                  _reduce_pairs_epi32< Reducer >( _dst_, _src_, _count_ );
+        }
+        else
+#endif
+        {
+                _reduce_pairs_generic< T, Reducer >( _dst_, _src_, _count_ );
+        }
+}
+
+//=====================================================================
+//      iterative segment tree build
+//=====================================================================
+//
+//      builds the n internal nodes of a 2n layout, node i < n at _inner_[ i ],
+//      leaf j, node n + j, at _leaves_[ j ], the leaves may but don't have to
+//      follow the internal nodes in memory
+//
+//      nodes [ h, n ) have two leaf children, with n odd node h - 1 has the last
+//      internal node and the first leaf, below that every chunk [ lo, hi ) only
+//      reads nodes >= hi, so each chunk is a single pass of the pairwise kernel,
+//      parent builders that aren't reducers get the same chunks with a plain loop
+//
+
+template< typename T, typename Builder >
+NPL_ALWAYS_INLINE inline
+void _build_pairs ( T * _dst_, T const * _src_, std::size_t const _count_, Builder const & _builder_ ) noexcept
+{
+        if constexpr( is_reducer_v< Builder > )
+        {
+                _reduce_pairs< T, remove_cvref_t< Builder > >( _dst_, _src_, _count_ );
+        }
+        else
+        {
+                for( std::size_t i = 0; i < _count_; ++i )
+                {
+                        _dst_[ i ] = _builder_( _src_[ 2 * i ], _src_[ 2 * i + 1 ] );
+                }
+        }
+}
+
+template< typename T, typename Builder >
+inline
+void _build_levels ( T * _inner_, T const * _leaves_, std::size_t const _count_, Builder const & _builder_ ) noexcept
+{
+        if( _count_ < 2 )
+        {
+                return;
+        }
+
+        std::size_t const h = ( _count_ + 1 ) / 2;
+
+        _build_pairs( _inner_ + h, _leaves_ + ( 2 * h - _count_ ), _count_ - h, _builder_ );
+
+        std::size_t hi = h;
+
+        if( _count_ % 2 == 1 )
+        {
+                _inner_[ h - 1 ] = _builder_( _inner_[ _count_ - 1 ], _leaves_[ 0 ] );
+
+                hi = h - 1;
+        }
+        while( hi > 1 )
+        {
+                std::size_t const lo = ( hi + 1 ) / 2;
+
+                _build_pairs( _inner_ + lo, _inner_ + 2 * lo, hi - lo, _builder_ );
+
+                hi = lo;
+        }
+}
+
+
+
+} // namespace npl
@@ -241,7 +241,7 @@ void _construct_forward_with_exception_guarantees ( Alloc &, T * _begin1_, T * _
 
 template< typename Alloc, typename Ptr >
 static
-void _construct_backward_with_exception_guarantees ( Alloc & _alloc_, Ptr _begin1_, Ptr _end1_, Ptr _end2_ )
+void _construct_backward_with_exception_guarantees ( Alloc & _alloc_, Ptr _begin1_, Ptr _end1_, Ptr & _end2_ )
 {
         static_assert( is_cpp17_move_insertable_v< Alloc >,
                         "The specified type does not meet the requirements of cpp17_move_insertable" );
@@ -71,6 +71,16 @@
 #       endif
 #endif
 
+#ifdef __GNUC__
+#       ifndef NPL_PREFETCH
+#       define NPL_PREFETCH(addr) __builtin_prefetch( addr )
+#       endif
+#else
+#       ifndef NPL_PREFETCH
+#       define NPL_PREFETCH(addr) ((void)0)
+#       endif
+#endif
+
 #ifdef NPL_USE_ATTRIBUTES
 #       ifdef __clang__
 #               ifndef NPL_ALWAYS_INLINE
@@ -129,6 +139,10 @@
 #       endif
 #endif
 
+#ifndef NPL_CACHELINE_SIZE
+#define NPL_CACHELINE_SIZE 64
+#endif
+
 #ifndef NPL_STD_VER
 #       if __cplusplus <= 201103L
 #               define NPL_STD_VER 11
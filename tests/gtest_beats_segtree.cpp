@@ -0,0 +1,124 @@
+//
+//
+//      natprolib
+//      gtest_beats_segtree.cpp
+//
+
+#include "gtest_beats_segtree.hpp"
+
+
+TEST( BeatsSegmentTreeTest, DefaultConstruct )
+{
+        npl::beats_segment_tree< long > seg;
+
+        EXPECT_EQ( seg._invariants(), true );
+        EXPECT_EQ( seg.empty()      , true );
+}
+
+TEST( BeatsSegmentTreeTest, FillConstruct )
+{
+        npl::beats_segment_tree< long > seg( CUSTOM_CAPACITY + 3, 4L );
+
+        EXPECT_EQ( seg._invariants(), true );
+        EXPECT_EQ( seg.size()       , CUSTOM_CAPACITY + 3 );
+        EXPECT_EQ( seg.range_sum()  , 4 * ( CUSTOM_CAPACITY + 3 ) );
+        EXPECT_EQ( seg.range_max()  , 4 );
+        EXPECT_EQ( seg.range_min()  , 4 );
+}
+
+TEST( BeatsSegmentTreeTest, ChminChmaxAdd )
+{
+        npl::beats_segment_tree< long > seg( { 5, 1, 9, 3, 7 } );
+
+        seg.chmin( 0, 4, 6 );
+
+        EXPECT_EQ( seg.range_sum( 0, 4 ), 21 );
+        EXPECT_EQ( seg.range_max( 0, 4 ),  6 );
+
+        seg.chmax( 1, 3, 4 );
+
+        EXPECT_EQ( seg.range_sum( 0, 4 ), 25 );
+        EXPECT_EQ( seg.range_min( 0, 4 ),  4 );
+        EXPECT_EQ( seg.element_at( 1 )  ,  4 );
+
+        seg.add( 2, 4, -10 );
+
+        EXPECT_EQ( seg.range_min( 0, 4 ), -6 );
+        EXPECT_EQ( seg.range_max( 2, 4 ), -4 );
+        EXPECT_EQ( seg.range_sum( 0, 4 ),  -5 );
+
+        npl::beats_segment_tree< long > copy( seg );
+        npl::beats_segment_tree< long > moved( NPL_MOVE( seg ) );
+
+        EXPECT_EQ( seg._invariants(), true );
+        EXPECT_EQ( seg.empty()      , true );
+        EXPECT_EQ( copy .range_sum(), -5 );
+        EXPECT_EQ( moved.range_sum(), -5 );
+}
+
+TEST( BeatsSegmentTreeTest, RandomOperations )
+{
+        constexpr std::size_t count = 77;
+
+        npl::vector< long > naive;
+
+        std::uint64_t state = 0x243f6a8885a308d3ULL;
+
+        auto next = [ & ]{ state ^= state << 13; state ^= state >> 7; state ^= state << 17; return state; };
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                naive.push_back( static_cast< long >( next() % 1000 ) - 500 );
+        }
+        npl::beats_segment_tree< long > seg( naive.begin(), naive.end() );
+
+        for( int step = 0; step < 2000; ++step )
+        {
+                std::size_t x = next() % count;
+                std::size_t y = next() % count;
+
+                if( x > y ) std::swap( x, y );
+
+                long val = static_cast< long >( next() % 1000 ) - 500;
+
+                switch( next() % 6 )
+                {
+                        case 0:
+                                seg.chmin( x, y, val );
+                                for( std::size_t i = x; i <= y; ++i ) naive[ i ] = std::min( naive[ i ], val );
+                                break;
+                        case 1:
+                                seg.chmax( x, y, val );
+                                for( std::size_t i = x; i <= y; ++i ) naive[ i ] = std::max( naive[ i ], val );
+                                break;
+                        case 2:
+                                seg.add( x, y, val / 10 );
+                                for( std::size_t i = x; i <= y; ++i ) naive[ i ] += val / 10;
+                                break;
+                        case 3:
+                                seg.update( x, val );
+                                naive[ x ] = val;
+                                break;
+                        default:
+                        {
+                                long sum = 0, mx = naive[ x ], mn = naive[ x ];
+
+                                for( std::size_t i = x; i <= y; ++i )
+                                {
+                                        sum += naive[ i ];
+                                        mx   = std::max( mx, naive[ i ] );
+                                        mn   = std::min( mn, naive[ i ] );
+                                }
+                                EXPECT_EQ( seg.range_sum( x, y ), sum );
+                                EXPECT_EQ( seg.range_max( x, y ),  mx );
+                                EXPECT_EQ( seg.range_min( x, y ),  mn );
+                        }
+                }
+        }
+        EXPECT_EQ( seg._invariants(), true );
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                EXPECT_EQ( seg.element_at( i ), naive[ i ] );
+        }
+}
@@ -0,0 +1,9 @@
+//
+//
+//      natprolib
+//      gtest_beats_segtree.hpp
+//
+
+#pragma once
+
+#include "gtest_nplib.hpp"
@@ -0,0 +1,122 @@
+//
+//
+//      natprolib
+//      gtest_concurrent_fenwick.cpp
+//
+
+#include "gtest_concurrent_fenwick.hpp"
+
+#include <atomic>
+#include <thread>
+
+
+TEST( ConcurrentFenwickTreeTest, DefaultConstruct )
+{
+        npl::concurrent_fenwick_tree<   int > int_ftree;
+        npl::concurrent_fenwick_tree< double > double_ftree;
+
+        EXPECT_EQ(    int_ftree._invariants(), true );
+        EXPECT_EQ( double_ftree._invariants(), true );
+        EXPECT_EQ(    int_ftree.empty()      , true );
+}
+
+TEST( ConcurrentFenwickTreeTest, FillConstruct )
+{
+        npl::concurrent_fenwick_tree< int > ftree( CUSTOM_CAPACITY + 1, CUSTOM_VALUE );
+
+        EXPECT_EQ( ftree._invariants(), true );
+        EXPECT_EQ( ftree.size()       , CUSTOM_CAPACITY + 1 );
+        EXPECT_EQ( ftree.range()      , ( CUSTOM_CAPACITY + 1 ) * CUSTOM_VALUE );
+        EXPECT_EQ( ftree.range( 2, 5 ), 4 * CUSTOM_VALUE );
+}
+
+TEST( ConcurrentFenwickTreeTest, RangeAdd )
+{
+        npl::concurrent_fenwick_tree< long > ftree( { 3, 1, 4, 1, 5, 9, 2 } );
+
+        EXPECT_EQ( ftree.range( 1, 4 ), 11 );
+
+        ftree.add( 2,  6 );
+        ftree.add( 6, -2 );
+
+        EXPECT_EQ( ftree.element_at( 2 ), 10 );
+        EXPECT_EQ( ftree.element_at( 6 ),  0 );
+        EXPECT_EQ( ftree.range( 1, 4 )  , 17 );
+        EXPECT_EQ( ftree.range()        , 29 );
+}
+
+//
+//      counters only ever grow, so a reader's total can't go down, and once
+//      the workers are joined no increment may have been lost
+//
+TEST( ConcurrentFenwickTreeTest, ConcurrentAdders )
+{
+        constexpr std::size_t count   =  1000;
+        constexpr std::size_t adds    = 20000;
+        constexpr std::size_t workers =     3;
+
+        npl::concurrent_fenwick_tree< long > ftree( count, 0L );
+
+        std::atomic< bool > done     { false };
+        std::atomic< int  > failures {     0 };
+
+        std::thread reader( [ & ]
+        {
+                long last = 0;
+
+                while( !done.load( std::memory_order_acquire ) )
+                {
+                        long const total = ftree.range();
+
+                        if( total < last || total > static_cast< long >( workers * adds ) )
+                        {
+                                failures.fetch_add( 1 );
+                        }
+                        last = total;
+                }
+        } );
+
+        npl::vector< std::thread > threads;
+
+        threads.reserve( workers );
+
+        for( std::size_t w = 0; w < workers; ++w )
+        {
+                threads.push_back( std::thread( [ &, w ]
+                {
+                        for( std::size_t i = 0; i < adds; ++i )
+                        {
+                                ftree.add( ( i * 7919 + w ) % count, 1 );
+                        }
+                } ) );
+        }
+        for( auto & t : threads )
+        {
+                t.join();
+        }
+        done.store( true, std::memory_order_release );
+
+        reader.join();
+
+        npl::vector< long > hits( count, 0L );
+
+        for( std::size_t w = 0; w < workers; ++w )
+        {
+                for( std::size_t i = 0; i < adds; ++i )
+                {
+                        ++hits[ ( i * 7919 + w ) % count ];
+                }
+        }
+        long expected = 0;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                expected += hits[ i ];
+
+                EXPECT_EQ( ftree.element_at( i ), hits[ i ] );
+                EXPECT_EQ( ftree.range( 0, i )  , expected  );
+        }
+        EXPECT_EQ( failures.load()    ,                                 0 );
+        EXPECT_EQ( ftree.range()      , static_cast< long >( workers * adds ) );
+        EXPECT_EQ( ftree._invariants(),                              true );
+}
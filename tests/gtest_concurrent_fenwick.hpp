@@ -0,0 +1,9 @@
+//
+//
+//      natprolib
+//      gtest_concurrent_fenwick.hpp
+//
+
+#pragma once
+
+#include "gtest_nplib.hpp"
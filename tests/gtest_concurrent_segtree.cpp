@@ -0,0 +1,130 @@
+//
+//
+//      natprolib
+//      gtest_concurrent_segtree.cpp
+//
+
+#include "gtest_concurrent_segtree.hpp"
+
+#include <atomic>
+#include <thread>
+
+
+TEST( ConcurrentSegmentTreeTest, DefaultConstruct )
+{
+        npl::concurrent_segment_tree< int, pb_sum< int > > seg;
+
+        EXPECT_EQ( seg._invariants(), true );
+        EXPECT_EQ( seg.empty()      , true );
+        EXPECT_EQ( seg.version()    ,    0 );
+}
+
+TEST( ConcurrentSegmentTreeTest, FillConstruct )
+{
+        npl::concurrent_segment_tree< int, pb_sum< int > > seg( CUSTOM_CAPACITY + 1, CUSTOM_VALUE );
+
+        EXPECT_EQ( seg._invariants(), true );
+        EXPECT_EQ( seg.size()       , CUSTOM_CAPACITY + 1 );
+        EXPECT_EQ( seg.range()      , ( CUSTOM_CAPACITY + 1 ) * CUSTOM_VALUE );
+}
+
+TEST( ConcurrentSegmentTreeTest, RangeUpdate )
+{
+        npl::concurrent_segment_tree< long, pb_sum< long > > seg( { 3, 1, 4, 1, 5, 9, 2 } );
+
+        EXPECT_EQ( seg.range( 1, 4 ), 11 );
+
+        seg.update( 2, 10 );
+
+        EXPECT_EQ( seg.version()      ,  1 );
+        EXPECT_EQ( seg.element_at( 2 ), 10 );
+        EXPECT_EQ( seg.range( 1, 4 )  , 17 );
+        EXPECT_EQ( seg.range()        , 31 );
+}
+
+TEST( ConcurrentSegmentTreeTest, MinMax )
+{
+        npl::concurrent_segment_tree< int, npl::reduce_min< int >{} > min_seg( { 5, 7, 9 } );
+        npl::concurrent_segment_tree< int, npl::reduce_max< int >{} > max_seg( { -5, -7, -9 } );
+
+        EXPECT_EQ( min_seg._invariants() , true );
+        EXPECT_EQ( min_seg.range()       ,    5 );
+        EXPECT_EQ( min_seg.range( 1, 2 ) ,    7 );
+        EXPECT_EQ( min_seg.element_at( 1 ),   7 );
+
+        EXPECT_EQ( max_seg.range()       ,   -5 );
+        EXPECT_EQ( max_seg.range( 1, 2 ) ,   -7 );
+        EXPECT_EQ( max_seg.element_at( 2 ),  -9 );
+
+        min_seg.update( 2, 3 );
+        max_seg.update( 2, 1 );
+
+        EXPECT_EQ( min_seg.range()       ,    3 );
+        EXPECT_EQ( min_seg.range( 0, 1 ) ,    5 );
+        EXPECT_EQ( max_seg.range()       ,    1 );
+        EXPECT_EQ( max_seg.range( 0, 1 ) ,   -5 );
+}
+
+//
+//      leaves only ever grow, so every reader has to see a non-decreasing total
+//      and never more than what the writer has published so far
+//
+TEST( ConcurrentSegmentTreeTest, ConcurrentReaders )
+{
+        constexpr std::size_t count   = 1000;
+        constexpr std::size_t updates = 20000;
+        constexpr std::size_t readers = 3;
+
+        npl::concurrent_segment_tree< long, pb_sum< long > > seg( count, 0L );
+
+        std::atomic< long > published { 0 };
+        std::atomic< bool > done      { false };
+        std::atomic< int  > failures  { 0 };
+
+        npl::vector< long > leaves( count, 0L );
+
+        std::thread writer( [ & ]
+        {
+                for( std::size_t i = 0; i < updates; ++i )
+                {
+                        std::size_t pos = ( i * 7919 ) % count;
+
+                        seg.update( pos, ++leaves[ pos ] );
+                        published.store( static_cast< long >( i + 1 ), std::memory_order_release );
+                }
+                done.store( true, std::memory_order_release );
+        } );
+
+        npl::vector< std::thread > threads;
+
+        threads.reserve( readers );
+
+        for( std::size_t r = 0; r < readers; ++r )
+        {
+                threads.push_back( std::thread( [ & ]
+                {
+                        long last = 0;
+
+                        while( !done.load( std::memory_order_acquire ) )
+                        {
+                                long total = seg.range();
+
+                                if( total < last || total > published.load( std::memory_order_acquire ) + 1 )
+                                {
+                                        failures.fetch_add( 1 );
+                                }
+                                last = total;
+                        }
+                } ) );
+        }
+        writer.join();
+
+        for( auto & t : threads )
+        {
+                t.join();
+        }
+        EXPECT_EQ( failures.load()  ,                             0 );
+        EXPECT_EQ( seg.range()      , static_cast< long >( updates ) );
+        EXPECT_EQ( seg.version()    ,                       updates );
+        EXPECT_EQ( seg._invariants(),                          true );
+}
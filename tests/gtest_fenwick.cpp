@@ -374,6 +374,156 @@ TEST( FenwickTreeTest, Clear )
         EXPECT_EQ( ftree, empty );
 }
 
+TEST( FenwickTreeTest, LinearBuild )
+{
+        std::vector< int > values;
+
+        for( int i = 0; i < 77; ++i )
+        {
+                values.push_back( ( i * 37 ) % 23 - 11 );
+        }
+
+        auto const expect_values = []( npl::fenwick_tree< int > const & ftree, std::vector< int > const & expected )
+        {
+                EXPECT_EQ( ftree._invariants(), true            );
+                EXPECT_EQ( ftree.size()       , expected.size() );
+
+                int sum = 0;
+
+                for( std::size_t i = 0; i < expected.size(); ++i )
+                {
+                        sum += expected[ i ];
+
+                        EXPECT_EQ( ftree.element_at( i )  , expected[ i ] );
+                        EXPECT_EQ( ftree.range( 0, i )    , sum           );
+                }
+        };
+
+        npl::fenwick_tree< int > pushed;
+
+        for( auto const & val : values )
+        {
+                pushed.push_back( val );
+        }
+
+        npl::fenwick_tree< int > built( values.data(), values.data() + values.size() );
+
+        EXPECT_EQ( built, pushed );
+        expect_values( built, values );
+
+        npl::fenwick_tree< int > filled( 77, 3 );
+
+        expect_values( filled, std::vector< int >( 77, 3 ) );
+
+        npl::fenwick_tree< int > listed( { 4, 8, 15, 16, 23, 42 } );
+
+        expect_values( listed, { 4, 8, 15, 16, 23, 42 } );
+
+        listed.assign( values.data(), values.data() + values.size() );
+
+        expect_values( listed, values );
+
+        listed.assign( 5, -2 );
+
+        expect_values( listed, std::vector< int >( 5, -2 ) );
+
+        std::vector< int > resized( values.begin(), values.begin() + 13 );
+
+        npl::fenwick_tree< int > grown( resized.data(), resized.data() + resized.size() );
+
+        grown.resize( 40, 6 );
+        resized.resize( 40, 6 );
+
+        expect_values( grown, resized );
+
+        grown.resize( 70 );
+        resized.resize( 70 );
+
+        expect_values( grown, resized );
+
+        std::vector< int > shorter( values.begin(), values.begin() + 29 );
+
+        for( std::size_t i = 0; i < shorter.size(); ++i )
+        {
+                shorter[ i ] = static_cast< int >( i );
+        }
+
+        npl::fenwick_tree< int > small( shorter.data(), shorter.data() + shorter.size() );
+
+        std::vector< int > sum  = values;
+        std::vector< int > diff = values;
+
+        for( std::size_t i = 0; i < shorter.size(); ++i )
+        {
+                sum [ i ] += shorter[ i ];
+                diff[ i ] -= shorter[ i ];
+        }
+
+        expect_values( built + small, sum  );
+        expect_values( built - small, diff );
+
+        for( std::size_t i = 0; i < shorter.size(); ++i )
+        {
+                diff[ i ] = -diff[ i ];
+        }
+        for( std::size_t i = shorter.size(); i < values.size(); ++i )
+        {
+                diff[ i ] = -values[ i ];
+        }
+
+        expect_values( small + built, sum  );
+        expect_values( small - built, diff );
+}
+
+TEST( FenwickTreeTest, LowerBoundPrefix )
+{
+        for( std::size_t count : { 1, 2, 7, 8, 64, 100 } )
+        {
+                std::vector< int > freq;
+
+                for( std::size_t i = 0; i < count; ++i )
+                {
+                        freq.push_back( static_cast< int >( ( i * 7 ) % 5 ) );
+                }
+
+                npl::fenwick_tree< int > ftree( freq.data(), freq.data() + freq.size() );
+
+                int total = 0;
+
+                for( auto const & f : freq )
+                {
+                        total += f;
+                }
+
+                for( int s = 0; s <= total + 1; ++s )
+                {
+                        std::size_t expected = 0;
+                        int         prefix   = freq[ 0 ];
+
+                        while( expected < count && prefix < s )
+                        {
+                                if( ++expected < count )
+                                {
+                                        prefix += freq[ expected ];
+                                }
+                        }
+
+                        EXPECT_EQ( ftree.lower_bound_prefix( s ), expected );
+
+                        if( s < total )
+                        {
+                                EXPECT_EQ( ftree.find_kth( s ), ftree.lower_bound_prefix( s + 1 ) );
+                                EXPECT_GT( freq[ ftree.find_kth( s ) ], 0 );
+                        }
+                }
+                EXPECT_EQ( ftree.find_kth( total ), count );
+        }
+
+        npl::fenwick_tree< int > empty;
+
+        EXPECT_EQ( empty.lower_bound_prefix( 1 ), 0 );
+}
+
 TEST( FenwickTreeTest, TwoDimensional )
 {
         npl::fenwick_tree< int > ftree1d( CUSTOM_CAPACITY, CUSTOM_VALUE );
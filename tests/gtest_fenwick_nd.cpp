@@ -0,0 +1,214 @@
+//
+//
+//      natprolib
+//      gtest_fenwick_nd.cpp
+//
+
+#include "gtest_fenwick_nd.hpp"
+
+
+TEST( FenwickTreeNDTest, DefaultConstruct )
+{
+        npl::fenwick_tree_nd<   int, 2 >    int_ftree;
+        npl::fenwick_tree_nd<  long, 3 >   long_ftree;
+        npl::fenwick_tree_nd< double, 1 > double_ftree;
+
+        EXPECT_EQ(    int_ftree._invariants(), true );
+        EXPECT_EQ(   long_ftree._invariants(), true );
+        EXPECT_EQ( double_ftree._invariants(), true );
+        EXPECT_EQ(    int_ftree.empty()      , true );
+}
+
+TEST( FenwickTreeNDTest, FillConstruct )
+{
+        npl::fenwick_tree_nd< int, 2 > ftree( { 7, CUSTOM_CAPACITY }, CUSTOM_VALUE );
+
+        EXPECT_EQ( ftree._invariants(),                   true );
+        EXPECT_EQ( ftree.size()       ,    7 * CUSTOM_CAPACITY );
+        EXPECT_EQ( ftree.extent( 0 )  ,                      7 );
+        EXPECT_EQ( ftree.extent( 1 )  ,        CUSTOM_CAPACITY );
+        EXPECT_EQ( ftree.range()      , 7 * CUSTOM_CAPACITY * CUSTOM_VALUE );
+
+        EXPECT_EQ( ftree.range( { 1, 2 }, { 3, 5 } ), 12 * CUSTOM_VALUE );
+        EXPECT_EQ( ftree.element_at( { 6, CUSTOM_CAPACITY - 1 } ), CUSTOM_VALUE );
+}
+
+TEST( FenwickTreeNDTest, Grid2D )
+{
+        std::size_t const rows = 13;
+        std::size_t const cols = 21;
+
+        std::vector< long > grid;
+
+        for( std::size_t i = 0; i < rows * cols; ++i )
+        {
+                grid.push_back( static_cast< long >( ( i * 37 ) % 23 ) - 11 );
+        }
+
+        npl::fenwick_tree_nd< long, 2 > ftree( { rows, cols }, grid.data() );
+
+        for( std::size_t step = 0; step < 40; ++step )
+        {
+                std::size_t const r = ( step * 7 ) % rows;
+                std::size_t const c = ( step * 11 ) % cols;
+
+                if( step % 2 )
+                {
+                        ftree.add( { r, c }, static_cast< long >( step ) );
+                        grid[ r * cols + c ] += static_cast< long >( step );
+                }
+                else
+                {
+                        ftree.update( { r, c }, -static_cast< long >( step ) );
+                        grid[ r * cols + c ] = -static_cast< long >( step );
+                }
+        }
+
+        EXPECT_EQ( ftree._invariants(), true );
+
+        for( std::size_t r0 = 0; r0 < rows; r0 += 3 )
+        {
+                for( std::size_t c0 = 0; c0 < cols; c0 += 4 )
+                {
+                        for( std::size_t r1 = r0; r1 < rows; ++r1 )
+                        {
+                                for( std::size_t c1 = c0; c1 < cols; ++c1 )
+                                {
+                                        long sum = 0;
+
+                                        for( std::size_t r = r0; r <= r1; ++r )
+                                        {
+                                                for( std::size_t c = c0; c <= c1; ++c )
+                                                {
+                                                        sum += grid[ r * cols + c ];
+                                                }
+                                        }
+                                        EXPECT_EQ( ftree.range( { r0, c0 }, { r1, c1 } ), sum );
+                                }
+                        }
+                }
+        }
+}
+
+TEST( FenwickTreeNDTest, Grid3D )
+{
+        std::size_t const n[ 3 ] = { 5, 6, 9 };
+
+        std::vector< int > grid( n[ 0 ] * n[ 1 ] * n[ 2 ] );
+
+        npl::fenwick_tree_nd< int, 3 > ftree( { n[ 0 ], n[ 1 ], n[ 2 ] } );
+
+        for( std::size_t step = 0; step < 100; ++step )
+        {
+                std::size_t const x = ( step * 3 ) % n[ 0 ];
+                std::size_t const y = ( step * 5 ) % n[ 1 ];
+                std::size_t const z = ( step * 7 ) % n[ 2 ];
+
+                ftree.add( { x, y, z }, static_cast< int >( step % 13 ) - 6 );
+                grid[ ( x * n[ 1 ] + y ) * n[ 2 ] + z ] += static_cast< int >( step % 13 ) - 6;
+        }
+
+        npl::fenwick_tree_nd< int, 3 > built( { n[ 0 ], n[ 1 ], n[ 2 ] }, grid.data() );
+
+        EXPECT_EQ( ftree, built );
+
+        for( std::size_t x0 = 0; x0 < n[ 0 ]; ++x0 )
+        {
+                for( std::size_t x1 = x0; x1 < n[ 0 ]; ++x1 )
+                {
+                        for( std::size_t y0 = 0; y0 < n[ 1 ]; y0 += 2 )
+                        {
+                                for( std::size_t z0 = 0; z0 < n[ 2 ]; z0 += 3 )
+                                {
+                                        std::size_t const y1 = y0 + ( n[ 1 ] - 1 - y0 ) / 2;
+                                        std::size_t const z1 = z0 + ( n[ 2 ] - 1 - z0 ) / 2;
+
+                                        int sum = 0;
+
+                                        for( std::size_t x = x0; x <= x1; ++x )
+                                        {
+                                                for( std::size_t y = y0; y <= y1; ++y )
+                                                {
+                                                        for( std::size_t z = z0; z <= z1; ++z )
+                                                        {
+                                                                sum += grid[ ( x * n[ 1 ] + y ) * n[ 2 ] + z ];
+                                                        }
+                                                }
+                                        }
+                                        EXPECT_EQ( ftree.range( { x0, y0, z0 }, { x1, y1, z1 } ), sum );
+                                }
+                        }
+                }
+        }
+        npl::fenwick_tree_nd< int, 3 > other;
+
+        other.swap( built );
+
+        EXPECT_EQ( built.empty(), true  );
+        EXPECT_EQ( ftree == other, true );
+}
+
+TEST( FenwickTreeNDTest, PaddedRows )
+{
+        std::size_t const rows =   9;
+        std::size_t const cols = 512;
+
+        std::vector< long > grid( rows * cols );
+
+        for( std::size_t i = 0; i < grid.size(); ++i )
+        {
+                grid[ i ] = static_cast< long >( i % 17 );
+        }
+
+        npl::fenwick_tree_nd< long, 2 > ftree( { rows, cols }, grid.data() );
+        npl::fenwick_tree_nd< long, 2 > added( { rows, cols } );
+
+        for( std::size_t r = 0; r < rows; ++r )
+        {
+                for( std::size_t c = 0; c < cols; ++c )
+                {
+                        added.add( { r, c }, grid[ r * cols + c ] );
+                }
+        }
+
+        EXPECT_EQ( ftree._invariants(),        true );
+        EXPECT_EQ( ftree.size()       , rows * cols );
+        EXPECT_EQ( ftree              ,       added );
+
+        for( std::size_t r0 = 0; r0 < rows; ++r0 )
+        {
+                for( std::size_t c0 = 0; c0 < cols; c0 += 37 )
+                {
+                        std::size_t const r1 = rows - 1                   ;
+                        std::size_t const c1 = c0 + ( cols - 1 - c0 ) / 2 ;
+
+                        long sum = 0;
+
+                        for( std::size_t r = r0; r <= r1; ++r )
+                        {
+                                for( std::size_t c = c0; c <= c1; ++c )
+                                {
+                                        sum += grid[ r * cols + c ];
+                                }
+                        }
+                        EXPECT_EQ( ftree.range( { r0, c0 }, { r1, c1 } ), sum );
+                }
+        }
+        EXPECT_EQ( ftree.range(), ftree.range( { 0, 0 }, { rows - 1, cols - 1 } ) );
+}
+
+TEST( FenwickTreeNDTest, PaddedRowsCompare )
+{
+        npl::fenwick_tree_nd< int, 2 > lhs( { 4, 1024 } );
+        npl::fenwick_tree_nd< int, 2 > rhs( { 4, 1024 } );
+
+        EXPECT_EQ( lhs, rhs );
+
+        rhs.add( { 3, 1023 }, 5 );
+
+        EXPECT_NE( lhs, rhs );
+
+        lhs.add( { 3, 1023 }, 5 );
+
+        EXPECT_EQ( lhs, rhs );
+}
@@ -0,0 +1,9 @@
+//
+//
+//      natprolib
+//      gtest_fenwick_nd.hpp
+//
+
+#pragma once
+
+#include "gtest_nplib.hpp"
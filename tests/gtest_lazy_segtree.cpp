@@ -0,0 +1,124 @@
+//
+//
+//      natprolib
+//      gtest_lazy_segtree.cpp
+//
+
+#include "gtest_lazy_segtree.hpp"
+
+
+TEST( LazySegmentTreeTest, DefaultConstruct )
+{
+        npl::lazy_segment_tree< int, pb_sum< int >, tb_add< int > > seg;
+
+        EXPECT_EQ( seg._invariants(), true );
+        EXPECT_EQ( seg.empty()      , true );
+}
+
+TEST( LazySegmentTreeTest, FillConstruct )
+{
+        npl::lazy_segment_tree< int, pb_sum< int >, tb_add< int > > seg( CUSTOM_CAPACITY + 1, CUSTOM_VALUE );
+
+        EXPECT_EQ( seg._invariants(),                      true );
+        EXPECT_EQ( seg.size()       ,       CUSTOM_CAPACITY + 1 );
+        EXPECT_EQ( seg.leaves()     ,       2 * CUSTOM_CAPACITY );
+        EXPECT_EQ( seg.range()      , CUSTOM_CAPACITY + 1       );
+}
+
+TEST( LazySegmentTreeTest, CopyMove )
+{
+        npl::lazy_segment_tree< int, pb_sum< int >, tb_add< int > > source( { 1, 2, 3, 4, 5 } );
+
+        source.update( 1, 3, 10 );
+
+        npl::lazy_segment_tree< int, pb_sum< int >, tb_add< int > > copy( source );
+        npl::lazy_segment_tree< int, pb_sum< int >, tb_add< int > > moved( NPL_MOVE( source ) );
+
+        EXPECT_EQ( source._invariants(), true );
+        EXPECT_EQ( source.empty()      , true );
+
+        for( std::size_t i = 0; i < 5; ++i )
+        {
+                EXPECT_EQ( copy .element_at( i ), moved.element_at( i ) );
+        }
+        EXPECT_EQ( copy.range(), 45 );
+}
+
+TEST( LazySegmentTreeTest, RangeAdd )
+{
+        constexpr std::size_t count = 37;
+
+        std::vector< long > naive( count );
+        npl::vector< long > source( count, 0L );
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                naive[ i ] = source[ i ] = static_cast< long >( i * 7 % 11 );
+        }
+
+        npl::lazy_segment_tree< long, pb_sum< long >, tb_add< long > > seg( source.begin(), source.end() );
+
+        for( std::size_t step = 0; step < 200; ++step )
+        {
+                std::size_t x = ( step * 13 ) % count;
+                std::size_t y = x + ( step * 29 ) % ( count - x );
+                long      tag = static_cast< long >( step % 9 ) - 4;
+
+                seg.update( x, y, tag );
+
+                for( std::size_t i = x; i <= y; ++i )
+                {
+                        naive[ i ] += tag;
+                }
+
+                std::size_t qx = ( step * 17 ) % count;
+                std::size_t qy = qx + ( step * 5 ) % ( count - qx );
+
+                long expected = 0;
+
+                for( std::size_t i = qx; i <= qy; ++i )
+                {
+                        expected += naive[ i ];
+                }
+                EXPECT_EQ( seg.range( qx, qy ), expected );
+        }
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                EXPECT_EQ( seg.element_at( i ), naive[ i ] );
+        }
+}
+
+TEST( LazySegmentTreeTest, RangeAssignAndPointUpdate )
+{
+        npl::lazy_segment_tree< int, pb_sum< int >, tb_assign< int > > seg( CUSTOM_CAPACITY, CUSTOM_VALUE );
+
+        seg.update( 2, 5, 3 );
+
+        EXPECT_EQ( seg.range( 0, 7 ), 2 + 4 * 3 + 2 );
+        EXPECT_EQ( seg.range( 3, 4 ),         2 * 3 );
+
+        seg.update( 4, 10 );
+
+        EXPECT_EQ( seg.element_at( 4 ), 10 );
+        EXPECT_EQ( seg.element_at( 5 ),  3 );
+        EXPECT_EQ( seg.range( 0, 7 ), 2 + 3 * 3 + 10 + 2 );
+
+        seg.update( 0, 7, 1 );
+
+        EXPECT_EQ( seg.range(), CUSTOM_CAPACITY );
+}
+
+TEST( LazySegmentTreeTest, RangeShiftMin )
+{
+        npl::lazy_segment_tree< int, npl::reduce_min< int >{}, tb_shift< int > > seg( { 5, 7, 9, 4, 8 } );
+
+        EXPECT_EQ( seg.range()      , 4 );
+        EXPECT_EQ( seg.range( 0, 2 ), 5 );
+        EXPECT_EQ( seg.range( 1, 2 ), 7 );
+
+        seg.update( 0, 2, 3 );
+
+        EXPECT_EQ( seg.range( 0, 2 ), 8 );
+        EXPECT_EQ( seg.range( 2, 4 ), 4 );
+        EXPECT_EQ( seg.range()      , 4 );
+}
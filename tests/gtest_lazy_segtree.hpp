@@ -0,0 +1,64 @@
+//
+//
+//      natprolib
+//      gtest_lazy_segtree.hpp
+//
+
+#pragma once
+
+#include "gtest_segtree.hpp"
+
+
+template< typename T >
+struct _tb_add
+{
+        T operator() ( T const & node, T const & tag, std::size_t len ) const
+        {
+                return node + tag * static_cast< T >( len );
+        }
+
+        T operator() ( T const & old, T const & tag ) const
+        {
+                return old + tag;
+        }
+};
+
+template< typename T >
+struct _tb_assign
+{
+        T operator() ( [[ maybe_unused ]] T const & node, T const & tag, std::size_t len ) const
+        {
+                return tag * static_cast< T >( len );
+        }
+
+        T operator() ( [[ maybe_unused ]] T const & old, T const & tag ) const
+        {
+                return tag;
+        }
+};
+
+//
+//      range add for min / max trees, every node in the range moves by the tag
+//
+template< typename T >
+struct _tb_shift
+{
+        T operator() ( T const & node, T const & tag, [[ maybe_unused ]] std::size_t len ) const
+        {
+                return node + tag;
+        }
+
+        T operator() ( T const & old, T const & tag ) const
+        {
+                return old + tag;
+        }
+};
+
+template< typename T >
+auto tb_add{ _tb_add< T >{} };
+
+template< typename T >
+auto tb_shift{ _tb_shift< T >{} };
+
+template< typename T >
+auto tb_assign{ _tb_assign< T >{} };
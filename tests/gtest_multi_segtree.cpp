@@ -0,0 +1,126 @@
+//
+//
+//      natprolib
+//      gtest_multi_segtree.cpp
+//
+
+#include "gtest_multi_segtree.hpp"
+
+
+using multi_stats = npl::multi_segment_tree< long, npl::reduce_sum< long >, npl::reduce_min< long >, npl::reduce_max< long > >;
+
+
+TEST( MultiSegmentTreeTest, DefaultConstruct )
+{
+        multi_stats seg;
+
+        EXPECT_EQ( seg._invariants(), true );
+        EXPECT_EQ( seg.empty()      , true );
+        EXPECT_EQ( seg.capacity()   ,    0 );
+}
+
+TEST( MultiSegmentTreeTest, FillConstruct )
+{
+        multi_stats seg( CUSTOM_CAPACITY + 1, CUSTOM_VALUE );
+
+        EXPECT_EQ( seg._invariants(), true );
+        EXPECT_EQ( seg.size()       , CUSTOM_CAPACITY + 1 );
+        EXPECT_EQ( seg.capacity()   , 4 * ( CUSTOM_CAPACITY + 1 ) );
+
+        auto res = seg.range();
+
+        EXPECT_EQ( res[ 0 ], ( CUSTOM_CAPACITY + 1 ) * CUSTOM_VALUE );
+        EXPECT_EQ( res[ 1 ], CUSTOM_VALUE );
+        EXPECT_EQ( res[ 2 ], CUSTOM_VALUE );
+}
+
+TEST( MultiSegmentTreeTest, ListConstruct )
+{
+        multi_stats seg( { 4, -8, 15, 16, -23, 42 } );
+
+        auto res = seg.range( 1, 4 );
+
+        EXPECT_EQ( res[ 0 ],   0 );
+        EXPECT_EQ( res[ 1 ], -23 );
+        EXPECT_EQ( res[ 2 ],  16 );
+
+        EXPECT_EQ( seg.range< 0 >(      ),  46 );
+        EXPECT_EQ( seg.range< 2 >( 0, 1 ),   4 );
+        EXPECT_EQ( seg.element_at( 5 )    ,  42 );
+
+        multi_stats copy( seg );
+        multi_stats moved( NPL_MOVE( seg ) );
+
+        EXPECT_EQ( moved._invariants(), true );
+        EXPECT_EQ( copy .range< 1 >()   , -23 );
+        EXPECT_EQ( moved.range< 1 >()   , -23 );
+        EXPECT_EQ( seg.empty()          , true );
+}
+
+template< typename Segtree, typename T >
+void check_multi_segtree ( npl::vector< T > & naive, Segtree & seg )
+{
+        std::size_t const count = naive.size();
+
+        for( std::size_t x = 0; x < count; x += 1 + count / 16 )
+        {
+                for( std::size_t y = x; y < count; y += 1 + count / 16 )
+                {
+                        T sum = 0;
+                        T min = naive[ x ];
+                        T max = naive[ x ];
+                        T xr  = 0;
+
+                        for( std::size_t i = x; i <= y; ++i )
+                        {
+                                sum += naive[ i ];
+                                xr  ^= naive[ i ];
+                                min  = naive[ i ] < min ? naive[ i ] : min;
+                                max  = naive[ i ] > max ? naive[ i ] : max;
+                        }
+                        auto res = seg.range( x, y );
+
+                        EXPECT_EQ( res[ 0 ], sum );
+                        EXPECT_EQ( res[ 1 ], min );
+                        EXPECT_EQ( res[ 2 ], max );
+                        EXPECT_EQ( res[ 3 ], xr  );
+
+                        EXPECT_EQ( seg.template range< 0 >( x, y ), sum );
+                        EXPECT_EQ( seg.template range< 1 >( x, y ), min );
+                        EXPECT_EQ( seg.template range< 2 >( x, y ), max );
+                        EXPECT_EQ( seg.template range< 3 >( x, y ), xr  );
+                }
+        }
+}
+
+TEST( MultiSegmentTreeTest, RangeAndUpdate )
+{
+        using segtree = npl::multi_segment_tree< int, npl::reduce_sum< int >, npl::reduce_min< int >,
+                                                      npl::reduce_max< int >, npl::reduce_xor< int > >;
+
+        for( std::size_t count : { 1, 2, 3, 7, 8, 17, 100, 1025 } )
+        {
+                npl::vector< int > naive;
+
+                for( std::size_t i = 0; i < count; ++i )
+                {
+                        naive.push_back( static_cast< int >( i * 37 % 101 ) - 50 );
+                }
+
+                segtree seg( naive.begin(), naive.end() );
+
+                EXPECT_EQ( seg._invariants(), true );
+
+                check_multi_segtree( naive, seg );
+
+                for( std::size_t step = 0; step < 64; ++step )
+                {
+                        std::size_t pos = ( step * 613 ) % count;
+                        int         val = static_cast< int >( step * 29 % 83 ) - 41;
+
+                        seg.update( pos, val );
+                        naive[ pos ] = val;
+                }
+                check_multi_segtree( naive, seg );
+        }
+}
@@ -35,6 +35,22 @@
 #include <range_queries/prefix_array>
 #include <range_queries/fenwick_tree>
 #include <range_queries/segment_tree>
+#include <range_queries/lazy_segment_tree>
+#include <range_queries/wide_segment_tree>
+#include <range_queries/persistent_segment_tree>
+#include <range_queries/sparse_segment_tree>
+#include <range_queries/segment_tree_2d>
+#include <range_queries/wavelet_matrix>
+#include <range_queries/beats_segment_tree>
+#include <range_queries/concurrent_segment_tree>
+#include <range_queries/multi_segment_tree>
+#include <range_queries/segment_tree_view>
+#include <range_queries/static_segment_tree>
+#include <range_queries/static_fenwick_tree>
+#include <range_queries/range_fenwick_tree>
+#include <range_queries/fenwick_tree_nd>
+#include <range_queries/padded_fenwick_tree>
+#include <range_queries/concurrent_fenwick_tree>
 
 
 #define CUSTOM_CAPACITY 8
@@ -0,0 +1,119 @@
+//
+//
+//      natprolib
+//      gtest_padded_fenwick.cpp
+//
+
+#include "gtest_padded_fenwick.hpp"
+
+
+TEST( PaddedFenwickTreeTest, DefaultConstruct )
+{
+        npl::padded_fenwick_tree<   int >    int_ftree;
+        npl::padded_fenwick_tree<  long >   long_ftree;
+        npl::padded_fenwick_tree< double > double_ftree;
+
+        EXPECT_EQ(    int_ftree._invariants(), true );
+        EXPECT_EQ(   long_ftree._invariants(), true );
+        EXPECT_EQ( double_ftree._invariants(), true );
+        EXPECT_EQ(    int_ftree.empty()      , true );
+}
+
+TEST( PaddedFenwickTreeTest, FillConstruct )
+{
+        npl::padded_fenwick_tree< int > ftree( CUSTOM_CAPACITY, CUSTOM_VALUE );
+
+        EXPECT_EQ( ftree._invariants(),            true );
+        EXPECT_EQ( ftree.size()       , CUSTOM_CAPACITY );
+        EXPECT_EQ( ftree.range()      , CUSTOM_CAPACITY * CUSTOM_VALUE );
+
+        for( std::size_t i = 0; i < CUSTOM_CAPACITY; ++i )
+        {
+                EXPECT_EQ( ftree.element_at( i ), CUSTOM_VALUE );
+        }
+}
+
+TEST( PaddedFenwickTreeTest, InitListConstruct )
+{
+        npl::padded_fenwick_tree< int > ftree( { 4, 8, 15, 16, 23, 42 } );
+
+        EXPECT_EQ( ftree._invariants()  , true );
+        EXPECT_EQ( ftree.size()         ,    6 );
+        EXPECT_EQ( ftree.range()        ,  108 );
+        EXPECT_EQ( ftree.range( 2, 4 )  ,   54 );
+        EXPECT_EQ( ftree.element_at( 5 ),   42 );
+        EXPECT_EQ( ftree.find_kth( 12 ) ,    2 );
+}
+
+//
+//      a few pages worth of nodes, every node has to match the plain layout
+//
+TEST( PaddedFenwickTreeTest, MatchesFenwickTree )
+{
+        std::size_t const count = 3 * 4096 + 77;
+
+        std::vector< long > values;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                values.push_back( static_cast< long >( ( i * 37 ) % 23 ) );
+        }
+
+        npl::padded_fenwick_tree< long > ftree( values.data(), values.data() + count );
+        npl::fenwick_tree       < long > plain( values.data(), values.data() + count );
+        npl::padded_fenwick_tree< long > pushed;
+
+        for( auto const & val : values )
+        {
+                pushed.push_back( val );
+        }
+
+        EXPECT_EQ( ftree._invariants(), true   );
+        EXPECT_EQ( ftree              , pushed );
+
+        for( std::size_t step = 0; step < 200; ++step )
+        {
+                std::size_t const i = ( step * 7919 ) % count;
+
+                if( step % 2 )
+                {
+                        ftree.add( i, static_cast< long >( step ) );
+                        values[ i ] += static_cast< long >( step );
+                }
+                else
+                {
+                        ftree.update( i, static_cast< long >( step % 5 ) );
+                        values[ i ] = static_cast< long >( step % 5 );
+                }
+        }
+        plain.assign( values.data(), values.data() + count );
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                EXPECT_EQ( ftree.at( i ), plain.at( i ) );
+        }
+        for( std::size_t x = 0; x < count; x += 509 )
+        {
+                EXPECT_EQ( ftree.element_at( x ), values[ x ] );
+
+                for( std::size_t y = x; y < count; y += 1021 )
+                {
+                        EXPECT_EQ( ftree.range( x, y ), plain.range( x, y ) );
+                }
+        }
+        for( long s = 1; s < ftree.range(); s += 997 )
+        {
+                EXPECT_EQ( ftree.lower_bound_prefix( s ), plain.lower_bound_prefix( s ) );
+        }
+
+        ftree.pop_back();
+        ftree.pop_back();
+
+        EXPECT_EQ( ftree._invariants(),     true );
+        EXPECT_EQ( ftree.size()       , count - 2 );
+        EXPECT_EQ( ftree.range()      , plain.range( 0, count - 3 ) );
+
+        ftree.clear();
+
+        EXPECT_EQ( ftree.empty(), true );
+}
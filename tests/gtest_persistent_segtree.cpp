@@ -0,0 +1,98 @@
+//
+//
+//      natprolib
+//      gtest_persistent_segtree.cpp
+//
+
+#include "gtest_persistent_segtree.hpp"
+
+
+TEST( PersistentSegmentTreeTest, DefaultConstruct )
+{
+        npl::persistent_segment_tree< int, pb_sum< int > > seg;
+
+        EXPECT_EQ( seg._invariants(), true );
+        EXPECT_EQ( seg.empty()      , true );
+        EXPECT_EQ( seg.versions()   ,    0 );
+}
+
+TEST( PersistentSegmentTreeTest, FillConstruct )
+{
+        npl::persistent_segment_tree< int, pb_sum< int > > seg( CUSTOM_CAPACITY + 1, CUSTOM_VALUE );
+
+        EXPECT_EQ( seg._invariants(),                    true );
+        EXPECT_EQ( seg.size()       ,     CUSTOM_CAPACITY + 1 );
+        EXPECT_EQ( seg.versions()   ,                       1 );
+        EXPECT_EQ( seg.node_count() , 2 * CUSTOM_CAPACITY + 1 );
+        EXPECT_EQ( seg.range( 0 )   ,     CUSTOM_CAPACITY + 1 );
+}
+
+TEST( PersistentSegmentTreeTest, CopyMove )
+{
+        npl::persistent_segment_tree< int, pb_sum< int > > source( { 1, 2, 3, 4, 5 } );
+
+        source.update( 2, 10 );
+
+        npl::persistent_segment_tree< int, pb_sum< int > > copy( source );
+        npl::persistent_segment_tree< int, pb_sum< int > > moved( NPL_MOVE( source ) );
+
+        EXPECT_EQ( source._invariants(), true );
+        EXPECT_EQ( source.empty()      , true );
+
+        EXPECT_EQ( copy .versions(), 2 );
+        EXPECT_EQ( moved.versions(), 2 );
+        EXPECT_EQ( copy .range( 0 ), 15 );
+        EXPECT_EQ( moved.range( 1 ), 22 );
+}
+
+TEST( PersistentSegmentTreeTest, Versions )
+{
+        constexpr std::size_t count    = 37;
+        constexpr std::size_t versions = 200;
+
+        npl::vector< long > source;
+        std::vector< long > initial;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source .push_back( static_cast< long >( i * 7 % 11 ) );
+                initial.push_back( static_cast< long >( i * 7 % 11 ) );
+        }
+
+        npl::persistent_segment_tree< long, pb_sum< long > > seg( source.begin(), source.end() );
+
+        std::vector< std::vector< long > > history( 1, initial );
+
+        for( std::size_t step = 1; step < versions; ++step )
+        {
+                std::size_t base = ( step * 31 ) % step;
+                std::size_t pos  = ( step * 13 ) % count;
+                long        val  = static_cast< long >( step % 17 ) - 8;
+
+                std::size_t nodes   = seg.node_count();
+                std::size_t version = seg.update( base, pos, val );
+
+                EXPECT_EQ( version, step );
+                EXPECT_LE( seg.node_count() - nodes, 7u );
+
+                history.push_back( history[ base ] );
+                history.back()[ pos ] = val;
+        }
+        for( std::size_t version = 0; version < versions; version += 7 )
+        {
+                for( std::size_t x = 0; x < count; x += 3 )
+                {
+                        for( std::size_t y = x; y < count; y += 5 )
+                        {
+                                long expected = 0;
+
+                                for( std::size_t i = x; i <= y; ++i )
+                                {
+                                        expected += history[ version ][ i ];
+                                }
+                                EXPECT_EQ( seg.range( version, x, y ), expected );
+                        }
+                }
+                EXPECT_EQ( seg.element_at( version, count - 1 ), history[ version ][ count - 1 ] );
+        }
+}
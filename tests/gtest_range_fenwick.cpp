@@ -0,0 +1,118 @@
+//
+//
+//      natprolib
+//      gtest_range_fenwick.cpp
+//
+
+#include "gtest_range_fenwick.hpp"
+
+
+TEST( RangeFenwickTreeTest, DefaultConstruct )
+{
+        npl::range_fenwick_tree<   int >    int_ftree;
+        npl::range_fenwick_tree<  long >   long_ftree;
+        npl::range_fenwick_tree< double > double_ftree;
+
+        EXPECT_EQ(    int_ftree._invariants(), true );
+        EXPECT_EQ(   long_ftree._invariants(), true );
+        EXPECT_EQ( double_ftree._invariants(), true );
+        EXPECT_EQ(    int_ftree.empty()      , true );
+}
+
+TEST( RangeFenwickTreeTest, FillConstruct )
+{
+        npl::range_fenwick_tree< int > ftree( CUSTOM_CAPACITY, CUSTOM_VALUE );
+
+        EXPECT_EQ( ftree._invariants(),            true );
+        EXPECT_EQ( ftree.size()       , CUSTOM_CAPACITY );
+        EXPECT_EQ( ftree.range()      , CUSTOM_CAPACITY * CUSTOM_VALUE );
+
+        for( std::size_t i = 0; i < CUSTOM_CAPACITY; ++i )
+        {
+                EXPECT_EQ( ftree.element_at( i ), CUSTOM_VALUE );
+        }
+}
+
+TEST( RangeFenwickTreeTest, InitListConstruct )
+{
+        npl::range_fenwick_tree< int > ftree( { 4, 8, 15, 16, 23, 42 } );
+
+        EXPECT_EQ( ftree._invariants()  , true );
+        EXPECT_EQ( ftree.size()         ,    6 );
+        EXPECT_EQ( ftree.range()        ,  108 );
+        EXPECT_EQ( ftree.range( 2, 4 )  ,   54 );
+        EXPECT_EQ( ftree.element_at( 5 ),   42 );
+}
+
+TEST( RangeFenwickTreeTest, RangeUpdate )
+{
+        std::vector< long > values;
+
+        for( long i = 0; i < 61; ++i )
+        {
+                values.push_back( ( i * 37 ) % 23 - 11 );
+        }
+
+        npl::range_fenwick_tree< long > ftree( values.data(), values.data() + values.size() );
+        npl::range_fenwick_tree< long > pushed;
+
+        for( auto const & val : values )
+        {
+                pushed.push_back( val );
+        }
+
+        EXPECT_EQ( ftree, pushed );
+
+        for( std::size_t step = 0; step < 50; ++step )
+        {
+                std::size_t const x = ( step * 17 ) % values.size();
+                std::size_t const y = x + ( step * 29 ) % ( values.size() - x );
+                long        const v = static_cast< long >( step % 9 ) - 4;
+
+                ftree.add( x, y, v );
+
+                for( std::size_t i = x; i <= y; ++i )
+                {
+                        values[ i ] += v;
+                }
+        }
+        ftree.update( 7, 1000 );
+        values[ 7 ] = 1000;
+
+        ftree.add( 60, -3 );
+        values[ 60 ] -= 3;
+
+        EXPECT_EQ( ftree._invariants(), true );
+
+        for( std::size_t x = 0; x < values.size(); ++x )
+        {
+                long sum = 0;
+
+                EXPECT_EQ( ftree.element_at( x ), values[ x ] );
+
+                for( std::size_t y = x; y < values.size(); ++y )
+                {
+                        sum += values[ y ];
+
+                        EXPECT_EQ( ftree.range( x, y ), sum );
+                }
+        }
+
+        ftree.pop_back();
+        values.pop_back();
+
+        ftree.push_back( 5 );
+        values.push_back( 5 );
+
+        long total = 0;
+
+        for( auto const & val : values )
+        {
+                total += val;
+        }
+        EXPECT_EQ( ftree.range(), total );
+
+        ftree.clear();
+
+        EXPECT_EQ( ftree.empty(), true );
+}
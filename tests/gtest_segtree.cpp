@@ -255,6 +255,354 @@ TEST( SegmentTreeTest, Range )
         }
 }
 
+TEST( SegmentTreeTest, RangeBatch )
+{
+        constexpr std::size_t count   = 1024;
+        constexpr std::size_t queries =  100;
+
+        npl::vector< int > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source.push_back( static_cast< int >( i * 31 % 97 ) );
+        }
+
+        npl::segment_tree< int, pb_sum< int > > segtree( source.begin(), source.end() );
+        npl::segment_tree< int, pb_max< int > > maxtree( source.begin(), source.end() );
+
+        std::size_t xs[ queries ];
+        std::size_t ys[ queries ];
+        int         sums[ queries ];
+        int         maxs[ queries ];
+
+        for( std::size_t i = 0; i < queries; ++i )
+        {
+                xs[ i ] = ( i * 7919 ) % count;
+                ys[ i ] = xs[ i ] + ( i * 104729 ) % ( count - xs[ i ] );
+        }
+
+        segtree.range_batch( xs, ys, sums, queries );
+        maxtree.range_batch( xs, ys, maxs, queries );
+
+        for( std::size_t i = 0; i < queries; ++i )
+        {
+                EXPECT_EQ( sums[ i ], segtree.range( xs[ i ], ys[ i ] ) );
+                EXPECT_EQ( maxs[ i ], maxtree.range( xs[ i ], ys[ i ] ) );
+        }
+}
+
+TEST( SegmentTreeTest, RangeNonPowerOfTwo )
+{
+        npl::segment_tree< int, pb_sum< int > > segtree( { 1, 2, 3, 4, 5 } );
+
+        for( std::size_t i = 0; i < 5; ++i )
+        {
+                for( std::size_t j = i; j < 5; ++j )
+                {
+                        EXPECT_EQ( segtree.range( i, j ), static_cast< int >( ( i + 1 + j + 1 ) * ( j - i + 1 ) / 2 ) );
+                }
+        }
+}
+
+TEST( SegmentTreeTest, UpdateBatch )
+{
+        constexpr std::size_t count = 1024;
+
+        npl::vector< int > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source.push_back( static_cast< int >( i % 13 ) );
+        }
+
+        npl::segment_tree< int, pb_sum< int > > batched( source.begin(), source.end() );
+        npl::segment_tree< int, pb_sum< int > > single ( source.begin(), source.end() );
+
+        for( std::size_t batch : { 1, 7, 50, 100, 2000 } )
+        {
+                npl::vector< std::size_t > positions;
+                npl::vector< int         > values;
+
+                for( std::size_t i = 0; i < batch; ++i )
+                {
+                        positions.push_back( ( i * 7919 + batch ) % count );
+                        values   .push_back( static_cast< int >( i * 31 % 17 ) - 8 );
+
+                        single.update( positions[ i ], values[ i ] );
+                }
+                batched.update_batch( positions.data(), values.data(), batch );
+
+                for( std::size_t x = 0; x < count; x += 37 )
+                {
+                        for( std::size_t y = x; y < count; y += 53 )
+                        {
+                                EXPECT_EQ( batched.range( x, y ), single.range( x, y ) );
+                        }
+                }
+                EXPECT_EQ( batched.range(), single.range() );
+        }
+}
+
+TEST( SegmentTreeTest, ParallelBuild )
+{
+        constexpr std::size_t count = ( 1 << 16 ) + 123;
+
+        npl::vector< long > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source.push_back( static_cast< long >( i * 7 % 101 ) );
+        }
+
+        npl::segment_tree< long, pb_sum< long > > serial  (                          source.begin(), source.end() );
+        npl::segment_tree< long, pb_sum< long > > parallel( npl::parallel_build_t{ 4 }, source.begin(), source.end() );
+
+        EXPECT_EQ( parallel.capacity(), serial.capacity() );
+
+        for( std::size_t i = 1; i < serial.size() + count; ++i )
+        {
+                EXPECT_EQ( parallel.element_at( i ), serial.element_at( i ) );
+        }
+
+        npl::segment_tree< long, pb_sum< long > > reassigned;
+
+        reassigned.assign( npl::parallel_build, source.begin(), source.end() );
+
+        EXPECT_EQ( reassigned.range(), serial.range() );
+        EXPECT_EQ( reassigned.range( 3, count - 5 ), serial.range( 3, count - 5 ) );
+}
+
+TEST( SegmentTreeTest, CompactStorage )
+{
+        for( std::size_t count : { 1, 2, 3, 5, 17, 100, 1025 } )
+        {
+                npl::vector< long > source;
+                std::vector< long > naive;
+
+                for( std::size_t i = 0; i < count; ++i )
+                {
+                        source.push_back( static_cast< long >( i * 7 % 23 ) );
+                        naive .push_back( static_cast< long >( i * 7 % 23 ) );
+                }
+
+                npl::compact_segment_tree< long, pb_sum< long > > segtree( source.begin(), source.end() );
+                npl::compact_segment_tree< long, pb_max< long > > maxtree( source.begin(), source.end() );
+
+                EXPECT_EQ( segtree.capacity(), 2 * count );
+                EXPECT_EQ( segtree.size()    ,     count );
+
+                for( std::size_t step = 0; step < 50; ++step )
+                {
+                        std::size_t pos = ( step * 613 ) % count;
+
+                        segtree.update( pos, static_cast< long >( step ) );
+                        maxtree.update( pos, static_cast< long >( step ) );
+                        naive[ pos ] = static_cast< long >( step );
+                }
+
+                for( std::size_t x = 0; x < count; x += 1 + count / 16 )
+                {
+                        for( std::size_t y = x; y < count; y += 1 + count / 16 )
+                        {
+                                long sum = 0;
+                                long max = naive[ x ];
+
+                                for( std::size_t i = x; i <= y; ++i )
+                                {
+                                        sum += naive[ i ];
+                                        max  = naive[ i ] > max ? naive[ i ] : max;
+                                }
+                                EXPECT_EQ( segtree.range( x, y ), sum );
+                                EXPECT_EQ( maxtree.range( x, y ), max );
+
+                                std::size_t xs[ 1 ] = { x };
+                                std::size_t ys[ 1 ] = { y };
+                                long        rs[ 1 ];
+
+                                segtree.range_batch( xs, ys, rs, 1 );
+
+                                EXPECT_EQ( rs[ 0 ], sum );
+                        }
+                }
+        }
+
+        npl::compact_segment_tree< int, pb_sum< int > > segtree( { 1, 2, 3, 4, 5, 6, 7, 8, 9 } );
+
+        segtree.assign( { 1, 2, 3, 4, 5 } );
+
+        EXPECT_EQ( segtree.capacity(),         10 );
+        EXPECT_EQ( segtree.range()   ,         15 );
+        EXPECT_EQ( segtree.range( 1, 3 ),       9 );
+}
+
+template< typename Segtree >
+void check_max_right_min_left ( std::size_t const count )
+{
+        npl::vector< long > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source.push_back( static_cast< long >( i * 13 % 29 ) );
+        }
+
+        Segtree segtree( source.begin(), source.end() );
+
+        for( long budget : { 0L, 5L, 40L, 300L, 100000L } )
+        {
+                auto pred = [ budget ]( long const sum ) { return sum <= budget; };
+
+                for( std::size_t l = 0; l <= count; ++l )
+                {
+                        std::size_t expected = l;
+                        long        sum      = 0;
+
+                        while( expected < count && sum + source[ expected ] <= budget )
+                        {
+                                sum += source[ expected++ ];
+                        }
+                        EXPECT_EQ( segtree.max_right( l, pred ), expected );
+                }
+                for( std::size_t r = 0; r < count; ++r )
+                {
+                        std::size_t expected = r + 1;
+                        long        sum      = 0;
+
+                        while( expected > 0 && sum + source[ expected - 1 ] <= budget )
+                        {
+                                sum += source[ --expected ];
+                        }
+                        EXPECT_EQ( segtree.min_left( r, pred ), expected );
+                }
+        }
+}
+
+TEST( SegmentTreeTest, MaxRightMinLeft )
+{
+        for( std::size_t count : { 1, 2, 7, 8, 64, 100 } )
+        {
+                check_max_right_min_left< npl::        segment_tree< long, pb_sum< long > > >( count );
+                check_max_right_min_left< npl::compact_segment_tree< long, pb_sum< long > > >( count );
+        }
+}
+
+template< typename T, auto Reducer >
+void check_reducer_segtree ( std::size_t const count )
+{
+        using reducer = decltype( Reducer );
+
+        npl::vector< T > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source.push_back( static_cast< T >( static_cast< long >( i * 37 % 101 ) - 50 ) );
+        }
+
+        npl::        segment_tree< T, Reducer > segtree( source.begin(), source.end() );
+        npl::compact_segment_tree< T, Reducer > compact( source.begin(), source.end() );
+
+        for( std::size_t x = 0; x < count; x += 1 + count / 16 )
+        {
+                for( std::size_t y = x; y < count; y += 1 + count / 16 )
+                {
+                        T expected = reducer::identity();
+
+                        for( std::size_t i = x; i <= y; ++i )
+                        {
+                                expected = Reducer( expected, source[ i ] );
+                        }
+                        EXPECT_EQ( segtree.range( x, y ), expected );
+                        EXPECT_EQ( compact.range( x, y ), expected );
+                }
+        }
+}
+
+TEST( SegmentTreeTest, Reducers )
+{
+        static_assert(  npl::is_reducer_v< npl::reduce_sum< int > > );
+        static_assert(  npl::is_reducer_v< npl::reduce_gcd< int > const > );
+        static_assert( !npl::is_reducer_v< decltype( pb_sum< int > ) > );
+
+        static_assert(  npl::reducer_traits< npl::reduce_max< int >, int >::idempotent );
+        static_assert( !npl::reducer_traits< npl::reduce_xor< int >, int >::idempotent );
+        static_assert( !npl::reducer_traits< decltype( pb_sum< int > ), int >::known );
+
+        static_assert( npl::reduce_gcd< int >()( -12, 18 ) == 6 );
+        static_assert( npl::reduce_gcd< int >()(   0,  7 ) == 7 );
+
+        for( std::size_t count : { 1, 2, 3, 8, 17, 100, 1025 } )
+        {
+                check_reducer_segtree<   int, npl::reduce_sum<   int >{} >( count );
+                check_reducer_segtree<   int, npl::reduce_min<   int >{} >( count );
+                check_reducer_segtree<   int, npl::reduce_max<   int >{} >( count );
+                check_reducer_segtree<   int, npl::reduce_xor<   int >{} >( count );
+                check_reducer_segtree<   int, npl::reduce_gcd<   int >{} >( count );
+                check_reducer_segtree<  long, npl::reduce_max<  long >{} >( count );
+                check_reducer_segtree< float, npl::reduce_min< float >{} >( count );
+                check_reducer_segtree< float, npl::reduce_max< float >{} >( count );
+        }
+
+        npl::segment_tree< int, npl::reduce_max< int >{} > maxtree( { -5, -3, -9, -7, -1 } );
+
+        EXPECT_EQ( maxtree.range( 0, 2 ), -3 );
+        EXPECT_EQ( maxtree.max_right( 0, []( int const max ) { return max < -2; } ), 4 );
+
+        maxtree.push_back( -4 );
+
+        EXPECT_EQ( maxtree.range( 5, 5 ), -4 );
+        EXPECT_EQ( maxtree.range( 2, 5 ), -1 );
+}
+
+template< typename Mintree, typename Maxtree >
+void check_range_arg ( std::size_t const count )
+{
+        npl::vector< long > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source.push_back( static_cast< long >( i * 37 % 19 ) - 9 );
+        }
+
+        Mintree mintree( source.begin(), source.end() );
+        Maxtree maxtree( source.begin(), source.end() );
+
+        for( std::size_t x = 0; x < count; x += 1 + count / 32 )
+        {
+                for( std::size_t y = x; y < count; y += 1 + count / 32 )
+                {
+                        std::size_t argmin = x;
+                        std::size_t argmax = x;
+
+                        for( std::size_t i = x; i <= y; ++i )
+                        {
+                                argmin = source[ i ] < source[ argmin ] ? i : argmin;
+                                argmax = source[ i ] > source[ argmax ] ? i : argmax;
+                        }
+                        EXPECT_EQ( mintree.range_argmin( x, y ), argmin );
+                        EXPECT_EQ( maxtree.range_argmax( x, y ), argmax );
+                }
+        }
+}
+
+TEST( SegmentTreeTest, RangeArgMinMax )
+{
+        for( std::size_t count : { 1, 2, 3, 7, 8, 17, 100, 1025 } )
+        {
+                check_range_arg< npl::        segment_tree< long, npl::reduce_min< long >{} >,
+                                 npl::        segment_tree< long, npl::reduce_max< long >{} > >( count );
+                check_range_arg< npl::compact_segment_tree< long, npl::reduce_min< long >{} >,
+                                 npl::compact_segment_tree< long, npl::reduce_max< long >{} > >( count );
+        }
+
+        npl::segment_tree< int, npl::reduce_max< int >{} > maxtree( { 3, 9, 1, 9, 4 } );
+
+        EXPECT_EQ( maxtree.range_argmax( 0, 4 ), 1 );
+        EXPECT_EQ( maxtree.range_argmax( 2, 4 ), 3 );
+
+        maxtree.push_back( 11 );
+
+        EXPECT_EQ( maxtree.range_argmax( 0, 5 ), 5 );
+}
+
 /*
 TEST( SegmentTreeTest, ParentBuilders )
 {
@@ -387,6 +735,65 @@ TEST( SegmentTreeTest, EmplaceBack )
 }
 */
 
+template< typename Segtree >
+void check_push_back_growth ( std::size_t const count )
+{
+        Segtree     segtree;
+        std::size_t capacity = 0;
+        std::size_t regrows  = 0;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                if( i % 2 == 0 ) segtree.push_back( static_cast< long >( i * 7 % 23 ) );
+                else          segtree.emplace_back( static_cast< long >( i * 7 % 23 ) );
+
+                if( segtree.capacity() != capacity )
+                {
+                        capacity = segtree.capacity();
+                        ++regrows;
+                }
+
+                long sum = 0;
+
+                for( std::size_t j = 0; j <= i; ++j )
+                {
+                        sum += static_cast< long >( j * 7 % 23 );
+                }
+                EXPECT_EQ( segtree.range( 0, i ), sum );
+                EXPECT_EQ( segtree.range( i, i ), static_cast< long >( i * 7 % 23 ) );
+        }
+        EXPECT_EQ( static_cast< std::size_t >( npl::distance( segtree.begin(), segtree.end() ) ), count );
+
+        std::size_t bound = 1;
+
+        for( std::size_t n = 1; n < count; n *= 2 )
+        {
+                ++bound;
+        }
+        EXPECT_LE( regrows, bound );
+}
+
+TEST( SegmentTreeTest, PushBackGrowth )
+{
+        for( std::size_t count : { 1, 2, 3, 5, 17, 100, 1025 } )
+        {
+                check_push_back_growth< npl::        segment_tree< long, pb_sum< long > > >( count );
+                check_push_back_growth< npl::compact_segment_tree< long, pb_sum< long > > >( count );
+        }
+
+        auto concat = []( std::string const & lhs, std::string const & rhs ) { return lhs + rhs; };
+
+        npl::segment_tree< std::string, concat > strings;
+
+        for( char c = 'a'; c <= 'z'; ++c )
+        {
+                strings.emplace_back( 1, c );
+        }
+        EXPECT_EQ( strings.range( 0, 25 ).size(), 26 );
+        EXPECT_EQ( strings.range( 3,  3 ), "d" );
+        EXPECT_EQ( strings.range( 3,  6 ).size(), 4 );
+}
+
 TEST( SegmentTreeTest, Swap )
 {
         npl::segment_tree< int > vec1( CUSTOM_CAPACITY, CUSTOM_VALUE     );
@@ -0,0 +1,118 @@
+//
+//
+//      natprolib
+//      gtest_segtree_2d.cpp
+//
+
+#include "gtest_segtree_2d.hpp"
+
+
+TEST( SegmentTree2DTest, DefaultConstruct )
+{
+        npl::segment_tree_2d< int, pb_sum< int > > seg;
+
+        EXPECT_EQ( seg._invariants(), true );
+        EXPECT_EQ( seg.empty()      , true );
+        EXPECT_EQ( seg.capacity()   ,    0 );
+}
+
+TEST( SegmentTree2DTest, FillConstruct )
+{
+        npl::segment_tree_2d< int, pb_sum< int > > seg( CUSTOM_CAPACITY + 1, CUSTOM_CAPACITY - 3, CUSTOM_VALUE );
+
+        EXPECT_EQ( seg._invariants(), true );
+        EXPECT_EQ( seg.rows()       , CUSTOM_CAPACITY + 1 );
+        EXPECT_EQ( seg.cols()       , CUSTOM_CAPACITY - 3 );
+        EXPECT_EQ( seg.range()      , ( CUSTOM_CAPACITY + 1 ) * ( CUSTOM_CAPACITY - 3 ) * CUSTOM_VALUE );
+        EXPECT_EQ( seg.range( 1, 2, 3, 4 ),  9 * CUSTOM_VALUE );
+}
+
+TEST( SegmentTree2DTest, ListConstruct )
+{
+        npl::segment_tree_2d< int, pb_max< int > > seg( { { 1, 5, 2 },
+                                                          { 7, 0, 3 } } );
+
+        EXPECT_EQ( seg.range()            , 7 );
+        EXPECT_EQ( seg.range( 0, 1, 1, 2 ), 5 );
+        EXPECT_EQ( seg.element_at( 1, 2 ) , 3 );
+
+        npl::segment_tree_2d< int, pb_max< int > > copy( seg );
+        npl::segment_tree_2d< int, pb_max< int > > moved( NPL_MOVE( seg ) );
+
+        EXPECT_EQ( seg.empty()   , true );
+        EXPECT_EQ( copy .range() ,    7 );
+        EXPECT_EQ( moved.range() ,    7 );
+}
+
+TEST( SegmentTree2DTest, Reducers )
+{
+        npl::segment_tree_2d< int, npl::reduce_min< int >{} > min_seg( { { 5,  7 },
+                                                                        { 9, 11 } } );
+        npl::segment_tree_2d< int, npl::reduce_max< int >{} > max_seg( { { -5,  -7 },
+                                                                        { -9, -11 } } );
+
+        EXPECT_EQ( min_seg.range( 0, 0, 1, 1 ),   5 );
+        EXPECT_EQ( min_seg.range( 1, 0, 1, 1 ),   9 );
+        EXPECT_EQ( min_seg.range( 0, 1, 1, 1 ),   7 );
+        EXPECT_EQ( max_seg.range( 0, 0, 1, 1 ),  -5 );
+        EXPECT_EQ( max_seg.range( 1, 1, 1, 1 ), -11 );
+
+        min_seg.update( 1, 1, 2 );
+
+        EXPECT_EQ( min_seg.range()            ,   2 );
+        EXPECT_EQ( min_seg.range( 0, 0, 0, 1 ),   5 );
+}
+
+TEST( SegmentTree2DTest, RangeUpdate )
+{
+        constexpr std::size_t rows = 13;
+        constexpr std::size_t cols = 22;
+
+        npl::vector< long > grid;
+
+        for( std::size_t i = 0; i < rows * cols; ++i )
+        {
+                grid.push_back( static_cast< long >( i * 37 % 19 ) - 9 );
+        }
+        npl::segment_tree_2d< long, pb_sum< long > > seg( rows, cols, grid.begin() );
+
+        auto check = [ & ]
+        {
+                for( std::size_t x1 = 0; x1 < rows; x1 += 2 )
+                {
+                        for( std::size_t x2 = x1; x2 < rows; x2 += 3 )
+                        {
+                                for( std::size_t y1 = 0; y1 < cols; y1 += 3 )
+                                {
+                                        for( std::size_t y2 = y1; y2 < cols; y2 += 4 )
+                                        {
+                                                long expected = 0;
+
+                                                for( std::size_t x = x1; x <= x2; ++x )
+                                                {
+                                                        for( std::size_t y = y1; y <= y2; ++y )
+                                                        {
+                                                                expected += grid[ x * cols + y ];
+                                                        }
+                                                }
+                                                EXPECT_EQ( seg.range( x1, y1, x2, y2 ), expected );
+                                        }
+                                }
+                        }
+                }
+        };
+        check();
+
+        for( std::size_t step = 0; step < 50; ++step )
+        {
+                std::size_t x   = ( step * 7  ) % rows;
+                std::size_t y   = ( step * 11 ) % cols;
+                long        val = static_cast< long >( step % 23 ) - 11;
+
+                seg.update( x, y, val );
+                grid[ x * cols + y ] = val;
+
+                EXPECT_EQ( seg.element_at( x, y ), val );
+        }
+        check();
+}
@@ -0,0 +1,111 @@
+//
+//
+//      natprolib
+//      gtest_segtree_view.cpp
+//
+
+#include "gtest_segtree_view.hpp"
+
+
+TEST( SegmentTreeViewTest, DefaultConstruct )
+{
+        npl::segment_tree_view< int, pb_sum< int > > view;
+
+        EXPECT_EQ( view._invariants(), true );
+        EXPECT_EQ( view.empty()      , true );
+        EXPECT_EQ( view.capacity()   ,    0 );
+}
+
+TEST( SegmentTreeViewTest, BorrowsLeaves )
+{
+        int leaves[] = { 4, 8, 15, 16, 23, 42, 7 };
+
+        npl::segment_tree_view< int, pb_sum< int > > view( leaves, 7 );
+
+        EXPECT_EQ( view._invariants(), true );
+        EXPECT_EQ( view.size()       , 7 );
+        EXPECT_EQ( view.capacity()   , 7 );
+        EXPECT_EQ( view.data()       , leaves );
+        EXPECT_EQ( view.range()      , 115 );
+        EXPECT_EQ( view.range( 2, 4 ),  54 );
+
+        view.update( 3, 0 );
+
+        EXPECT_EQ( leaves[ 3 ]       ,  0 );
+        EXPECT_EQ( view.range( 2, 4 ), 38 );
+
+        leaves[ 0 ] = 100;
+        view.refresh( 0 );
+
+        EXPECT_EQ( view.range( 0, 1 ), 108 );
+
+        leaves[ 5 ] = 0;
+        leaves[ 6 ] = 0;
+        view.refresh();
+
+        EXPECT_EQ( view.range(), 146 );
+
+        npl::segment_tree_view< int, pb_sum< int > > moved( NPL_MOVE( view ) );
+
+        EXPECT_EQ( moved.range()     , 146 );
+        EXPECT_EQ( view.empty()      , true );
+        EXPECT_EQ( view._invariants(), true );
+}
+
+template< typename View >
+void check_segtree_view ( std::size_t const count )
+{
+        npl::vector< long > leaves;
+        npl::vector< long > naive;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                leaves.push_back( static_cast< long >( i * 37 % 101 ) - 50 );
+                naive .push_back( static_cast< long >( i * 37 % 101 ) - 50 );
+        }
+
+        View view( leaves.data(), leaves.data() + leaves.size() );
+
+        for( std::size_t step = 0; step < 32; ++step )
+        {
+                std::size_t pos = ( step * 613 ) % count;
+                long        val = static_cast< long >( step * 29 % 83 ) - 41;
+
+                view.update( pos, val );
+                naive[ pos ] = val;
+        }
+
+        for( std::size_t x = 0; x < count; x += 1 + count / 16 )
+        {
+                for( std::size_t y = x; y < count; y += 1 + count / 16 )
+                {
+                        long sum = 0;
+                        long min = naive[ x ];
+
+                        for( std::size_t i = x; i <= y; ++i )
+                        {
+                                sum += naive[ i ];
+                                min  = naive[ i ] < min ? naive[ i ] : min;
+                        }
+                        if constexpr( npl::is_same_v< npl::remove_cvref_t< typename View::parent_builder_type >, npl::reduce_min< long > > )
+                        {
+                                EXPECT_EQ( view.range( x, y ), min );
+                        }
+                        else
+                        {
+                                EXPECT_EQ( view.range( x, y ), sum );
+                        }
+                        EXPECT_EQ( view.element_at( y ), leaves[ y ] );
+                }
+        }
+}
+
+TEST( SegmentTreeViewTest, RangeAndUpdate )
+{
+        for( std::size_t count : { 1, 2, 3, 7, 8, 17, 100, 1025 } )
+        {
+                check_segtree_view< npl::segment_tree_view< long, pb_sum< long > > >( count );
+                check_segtree_view< npl::segment_tree_view< long, npl::reduce_sum< long >{} > >( count );
+                check_segtree_view< npl::segment_tree_view< long, npl::reduce_min< long >{} > >( count );
+        }
+}
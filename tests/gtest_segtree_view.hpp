@@ -0,0 +1,9 @@
+//
+//
+//      natprolib
+//      gtest_segtree_view.hpp
+//
+
+#pragma once
+
+#include "gtest_segtree.hpp"
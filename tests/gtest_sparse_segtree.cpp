@@ -0,0 +1,144 @@
+//
+//
+//      natprolib
+//      gtest_sparse_segtree.cpp
+//
+
+#include "gtest_sparse_segtree.hpp"
+
+#include <map>
+
+
+TEST( SparseSegmentTreeTest, DefaultConstruct )
+{
+        npl::sparse_segment_tree< long, pb_sum< long > > seg;
+
+        EXPECT_EQ( seg._invariants(), true );
+        EXPECT_EQ( seg.empty()      , true );
+        EXPECT_EQ( seg.node_count() ,    1 );
+        EXPECT_EQ( seg.range()      ,    0 );
+        EXPECT_EQ( seg.hi()         , std::numeric_limits< std::uint64_t >::max() );
+}
+
+TEST( SparseSegmentTreeTest, FullDomain )
+{
+        npl::sparse_segment_tree< long, pb_sum< long > > seg;
+
+        constexpr std::uint64_t top = std::numeric_limits< std::uint64_t >::max();
+
+        seg.update(       0,  1 );
+        seg.update(     top,  2 );
+        seg.update( top / 2,  4 );
+        seg.update( top / 2,  8 );
+
+        EXPECT_EQ( seg._invariants(), true );
+        EXPECT_LE( seg.node_count() , 3u * 64 + 1 );
+
+        EXPECT_EQ( seg.range()                      , 11 );
+        EXPECT_EQ( seg.range( 0, top - 1 )          ,  9 );
+        EXPECT_EQ( seg.range( 1, top     )          , 10 );
+        EXPECT_EQ( seg.range( 1, top - 1 )          ,  8 );
+        EXPECT_EQ( seg.element_at( top / 2 )        ,  8 );
+        EXPECT_EQ( seg.element_at( top / 2 + 1 )    ,  0 );
+}
+
+TEST( SparseSegmentTreeTest, SignedDomain )
+{
+        npl::sparse_segment_tree< int, pb_max< int >, std::int64_t > seg;
+
+        seg.update( std::numeric_limits< std::int64_t >::lowest(), 3 );
+        seg.update( -5, 7 );
+        seg.update( std::numeric_limits< std::int64_t >::max(), 5 );
+
+        EXPECT_EQ( seg.range()          , 7 );
+        EXPECT_EQ( seg.range( -4, 1L << 40 ), 0 );
+        EXPECT_EQ( seg.range( -5, 1L << 40 ), 7 );
+        EXPECT_EQ( seg.range( -4, std::numeric_limits< std::int64_t >::max() ), 5 );
+        EXPECT_EQ( seg.range( std::numeric_limits< std::int64_t >::lowest(), -6 ), 3 );
+}
+
+TEST( SparseSegmentTreeTest, CopyMoveClear )
+{
+        npl::sparse_segment_tree< long, pb_sum< long > > source( 0, 1000 );
+
+        source.update( 10, 5 );
+        source.update( 20, 6 );
+
+        npl::sparse_segment_tree< long, pb_sum< long > > copy( source );
+        npl::sparse_segment_tree< long, pb_sum< long > > moved( NPL_MOVE( source ) );
+
+        EXPECT_EQ( copy .range( 0, 15 ),  5 );
+        EXPECT_EQ( moved.range()       , 11 );
+
+        EXPECT_EQ( source._invariants(), true );
+        EXPECT_EQ( source.empty()      , true );
+        EXPECT_EQ( source.range()      ,    0 );
+
+        source.update( 30, 7 );
+
+        EXPECT_EQ( source.range( 0, 100 ), 7 );
+        EXPECT_EQ( moved .range( 0, 100 ), 11 );
+
+        moved.clear();
+
+        EXPECT_EQ( moved._invariants(), true );
+        EXPECT_EQ( moved.empty()      , true );
+        EXPECT_EQ( moved.range()      ,    0 );
+        EXPECT_EQ( copy .range()      ,   11 );
+}
+
+TEST( SparseSegmentTreeTest, Reducers )
+{
+        npl::sparse_segment_tree< int, npl::reduce_min< int >{} > seg( 0, 1000 );
+
+        EXPECT_EQ( seg.range(), std::numeric_limits< int >::max() );
+
+        seg.update( 10, 5 );
+        seg.update( 20, 7 );
+        seg.update( 30, 9 );
+
+        EXPECT_EQ( seg.range()          ,                                5 );
+        EXPECT_EQ( seg.range( 15, 100 ) ,                                7 );
+        EXPECT_EQ( seg.range( 25,  30 ) ,                                9 );
+        EXPECT_EQ( seg.range( 40, 900 ) , std::numeric_limits< int >::max() );
+}
+
+TEST( SparseSegmentTreeTest, RandomUpdates )
+{
+        constexpr std::uint64_t domain = 1ULL << 40;
+
+        npl::sparse_segment_tree< long, pb_sum< long > > seg( 0, domain - 1 );
+
+        std::map< std::uint64_t, long > naive;
+
+        std::uint64_t state = 0x9e3779b97f4a7c15ULL;
+
+        auto next = [ & ]{ state ^= state << 13; state ^= state >> 7; state ^= state << 17; return state; };
+
+        for( int step = 0; step < 500; ++step )
+        {
+                std::uint64_t key = next() % domain;
+                long          val = static_cast< long >( next() % 100 );
+
+                seg.update( key, val );
+                naive[ key ] = val;
+        }
+        EXPECT_EQ( seg._invariants(), true );
+        EXPECT_LE( seg.node_count() , 500u * 40 + 1 );
+
+        for( int step = 0; step < 200; ++step )
+        {
+                std::uint64_t x = next() % domain;
+                std::uint64_t y = next() % domain;
+
+                if( x > y ) std::swap( x, y );
+
+                long expected = 0;
+
+                for( auto it = naive.lower_bound( x ); it != naive.end() && it->first <= y; ++it )
+                {
+                        expected += it->second;
+                }
+                EXPECT_EQ( seg.range( x, y ), expected );
+        }
+}
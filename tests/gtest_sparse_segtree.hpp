@@ -0,0 +1,9 @@
+//
+//
+//      natprolib
+//      gtest_sparse_segtree.hpp
+//
+
+#pragma once
+
+#include "gtest_segtree.hpp"
@@ -0,0 +1,120 @@
+//
+//
+//      natprolib
+//      gtest_static_fenwick.cpp
+//
+
+#include "gtest_static_fenwick.hpp"
+
+
+TEST( StaticFenwickTest, DefaultConstruct )
+{
+        constexpr npl::static_fenwick_tree< int, CUSTOM_CAPACITY > fenwick;
+
+        static_assert( fenwick.empty()                      );
+        static_assert( fenwick.capacity() == CUSTOM_CAPACITY );
+}
+
+TEST( StaticFenwickTest, FillConstruct )
+{
+        constexpr npl::static_fenwick_tree< int, CUSTOM_CAPACITY > fenwick( CUSTOM_CAPACITY, CUSTOM_VALUE );
+
+        static_assert( fenwick.size()        == CUSTOM_CAPACITY );
+        static_assert( fenwick.range()       == CUSTOM_CAPACITY * CUSTOM_VALUE );
+        static_assert( fenwick.range( 2, 5 ) == 4 * CUSTOM_VALUE );
+        static_assert( fenwick[ 7 ]          == CUSTOM_CAPACITY * CUSTOM_VALUE );
+}
+
+TEST( StaticFenwickTest, InitListConstruct )
+{
+        constexpr npl::static_fenwick_tree< int, CUSTOM_CAPACITY > fenwick( { 4, 8, 15, 16, 23, 42, 7 } );
+
+        static_assert( fenwick.size()          ==   7 );
+        static_assert( fenwick.range()         == 115 );
+        static_assert( fenwick.range( 2, 4 )   ==  54 );
+        static_assert( fenwick.element_at( 5 ) ==  42 );
+
+        constexpr npl::static_fenwick_tree< int, CUSTOM_CAPACITY > copy( fenwick );
+
+        static_assert( copy == fenwick );
+}
+
+consteval bool static_fenwick_test_push_back () noexcept
+{
+        npl::static_fenwick_tree< long, 16 > pushed;
+
+        for( long i = 1; i <= 13; ++i )
+        {
+                pushed.push_back( i * i );
+        }
+        pushed.update( 6, 0 );
+        pushed.add( 2, 10 );
+        pushed.pop_back();
+
+        long values[ 12 ];
+
+        for( long i = 1; i <= 12; ++i )
+        {
+                values[ i - 1 ] = i * i;
+        }
+        values[ 6 ]  = 0;
+        values[ 2 ] += 10;
+
+        npl::static_fenwick_tree< long, 16 > built( values, values + 12 );
+
+        return pushed == built && built.range( 3, 9 ) == 16 + 25 + 36 + 64 + 81 + 100;
+}
+
+TEST( StaticFenwickTest, ConstantEvaluation )
+{
+        static_assert( static_fenwick_test_push_back() );
+}
+
+TEST( StaticFenwickTest, FindKth )
+{
+        constexpr npl::static_fenwick_tree< int, CUSTOM_CAPACITY > freq( { 2, 0, 3, 1, 0, 4 } );
+
+        static_assert( freq.lower_bound_prefix(  0 ) == 0 );
+        static_assert( freq.lower_bound_prefix(  3 ) == 2 );
+        static_assert( freq.lower_bound_prefix(  6 ) == 3 );
+        static_assert( freq.lower_bound_prefix( 11 ) == 6 );
+
+        static_assert( freq.find_kth( 1 ) == 0 );
+        static_assert( freq.find_kth( 2 ) == 2 );
+        static_assert( freq.find_kth( 5 ) == 3 );
+        static_assert( freq.find_kth( 6 ) == 5 );
+        static_assert( freq.find_kth( 9 ) == 5 );
+}
+
+TEST( StaticFenwickTest, Runtime )
+{
+        constexpr std::size_t cap = 45;
+
+        std::vector< int > values;
+
+        for( std::size_t i = 0; i < cap; ++i )
+        {
+                values.push_back( static_cast< int >( ( i * 131 ) % 97 ) - 40 );
+        }
+
+        npl::static_fenwick_tree< int, cap > fenwick( values.data(), values.data() + values.size() );
+
+        fenwick.update( 20, 3 );
+        values[ 20 ] = 3;
+
+        for( std::size_t x = 0; x < cap; ++x )
+        {
+                int sum = 0;
+
+                for( std::size_t y = x; y < cap; ++y )
+                {
+                        sum += values[ y ];
+
+                        EXPECT_EQ( fenwick.range( x, y ), sum );
+                }
+        }
+
+        fenwick.clear();
+
+        EXPECT_EQ( fenwick.empty(), true );
+}
@@ -0,0 +1,9 @@
+//
+//
+//      natprolib
+//      gtest_static_fenwick.hpp
+//
+
+#pragma once
+
+#include "gtest_nplib.hpp"
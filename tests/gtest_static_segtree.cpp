@@ -0,0 +1,108 @@
+//
+//
+//      natprolib
+//      gtest_static_segtree.cpp
+//
+
+#include "gtest_static_segtree.hpp"
+
+
+TEST( StaticSegmentTreeTest, DefaultConstruct )
+{
+        constexpr npl::static_segment_tree< int, CUSTOM_CAPACITY, pb_sum< int > > segtree;
+
+        static_assert( segtree.empty()                      );
+        static_assert( segtree.capacity() == CUSTOM_CAPACITY );
+        static_assert( segtree._invariants()                );
+}
+
+TEST( StaticSegmentTreeTest, FillConstruct )
+{
+        constexpr npl::static_segment_tree< int, CUSTOM_CAPACITY, pb_sum< int > > segtree( 5, CUSTOM_VALUE );
+
+        static_assert( segtree.size()        == 5 );
+        static_assert( segtree.range()       == 5 * CUSTOM_VALUE );
+        static_assert( segtree.range( 1, 3 ) == 3 * CUSTOM_VALUE );
+        static_assert( segtree._invariants()      );
+}
+
+TEST( StaticSegmentTreeTest, InitListConstruct )
+{
+        constexpr npl::static_segment_tree< int, 7, npl::reduce_min< int >{} > segtree( { 4, 8, 15, 16, 23, 42, 7 } );
+
+        static_assert( segtree.size()        ==  7 );
+        static_assert( segtree.range()       ==  4 );
+        static_assert( segtree.range( 1, 5 ) ==  8 );
+        static_assert( segtree.range( 5, 6 ) ==  7 );
+        static_assert( segtree.element_at( 5 ) == 42 );
+
+        constexpr npl::static_segment_tree< int, 7, npl::reduce_min< int >{} > copy( segtree );
+
+        static_assert( copy == segtree );
+}
+
+consteval int static_segtree_test_lookup_table () noexcept
+{
+        npl::static_segment_tree< int, 10, pb_max< int > > segtree;
+
+        for( int i = 0; i < 10; ++i )
+        {
+                segtree.push_back( ( i * 7 ) % 10 );
+        }
+        segtree.update( 4, 100 );
+        segtree.pop_back();
+
+        return segtree.range( 0, 3 ) * 1000 + segtree.range( 2, 8 );
+}
+
+TEST( StaticSegmentTreeTest, ConstantEvaluation )
+{
+        static_assert( static_segtree_test_lookup_table() == 7 * 1000 + 100 );
+}
+
+TEST( StaticSegmentTreeTest, Runtime )
+{
+        constexpr std::size_t cap = 37;
+
+        std::vector< int > values;
+
+        for( std::size_t i = 0; i < cap; ++i )
+        {
+                values.push_back( static_cast< int >( ( i * 131 ) % 97 ) );
+        }
+
+        npl::static_segment_tree< int, cap, npl::reduce_sum< int >{} > sum_tree( values.data(), values.data() + values.size() );
+        npl::static_segment_tree< int, cap, npl::reduce_min< int >{} > min_tree;
+
+        for( auto const & val : values )
+        {
+                min_tree.push_back( val );
+        }
+
+        EXPECT_EQ( sum_tree._invariants(), true );
+        EXPECT_EQ( min_tree._invariants(), true );
+
+        sum_tree.update( 11, -5 );
+        min_tree.update( 11, -5 );
+        values[ 11 ] = -5;
+
+        for( std::size_t x = 0; x < cap; ++x )
+        {
+                int sum = 0;
+                int min = values[ x ];
+
+                for( std::size_t y = x; y < cap; ++y )
+                {
+                        sum += values[ y ];
+                        min  = std::min( min, values[ y ] );
+
+                        EXPECT_EQ( sum_tree.range( x, y ), sum );
+                        EXPECT_EQ( min_tree.range( x, y ), min );
+                }
+        }
+
+        min_tree.clear();
+
+        EXPECT_EQ( min_tree.empty()      , true );
+        EXPECT_EQ( min_tree._invariants(), true );
+}
@@ -0,0 +1,9 @@
+//
+//
+//      natprolib
+//      gtest_static_segtree.hpp
+//
+
+#pragma once
+
+#include "gtest_segtree.hpp"
@@ -0,0 +1,107 @@
+//
+//
+//      natprolib
+//      gtest_wavelet.cpp
+//
+
+#include "gtest_wavelet.hpp"
+
+#include <algorithm>
+
+
+TEST( WaveletMatrixTest, DefaultConstruct )
+{
+        npl::wavelet_matrix< int > wm;
+
+        EXPECT_EQ( wm._invariants(), true );
+        EXPECT_EQ( wm.empty()      , true );
+        EXPECT_EQ( wm.height()     ,    0 );
+}
+
+TEST( WaveletMatrixTest, ListConstruct )
+{
+        npl::wavelet_matrix< int > wm( { 5, -3, 8, 5, 0, 12, -3 } );
+
+        EXPECT_EQ( wm._invariants(), true );
+        EXPECT_EQ( wm.size()       ,    7 );
+        EXPECT_EQ( wm.height()     ,    3 );
+
+        EXPECT_EQ( wm.element_at( 2 )          ,  8 );
+        EXPECT_EQ( wm.kth_smallest( 0, 6, 0 )  , -3 );
+        EXPECT_EQ( wm.kth_smallest( 0, 6, 6 )  , 12 );
+        EXPECT_EQ( wm.kth_smallest( 2, 4, 1 )  ,  5 );
+        EXPECT_EQ( wm.count_less( 0, 6, 5 )    ,  3 );
+        EXPECT_EQ( wm.count_less( 1, 3, 100 )  ,  3 );
+        EXPECT_EQ( wm.count_less( 1, 3, -100 ) ,  0 );
+        EXPECT_EQ( wm.count_between( 0, 6, 0, 9 ), 4 );
+}
+
+TEST( WaveletMatrixTest, SingleValue )
+{
+        npl::vector< long > source( 100, 7L );
+
+        npl::wavelet_matrix< long > wm( source.begin(), source.end() );
+
+        EXPECT_EQ( wm.height()                , 0 );
+        EXPECT_EQ( wm.kth_smallest( 3, 50, 9 ), 7 );
+        EXPECT_EQ( wm.count_less( 0, 99, 7 )  , 0 );
+        EXPECT_EQ( wm.count_less( 0, 99, 8 )  , 100 );
+}
+
+TEST( WaveletMatrixTest, CopyMove )
+{
+        npl::wavelet_matrix< int > source( { 4, 1, 3 } );
+
+        npl::wavelet_matrix< int > copy( source );
+        npl::wavelet_matrix< int > moved( NPL_MOVE( source ) );
+
+        EXPECT_EQ( source._invariants(), true );
+        EXPECT_EQ( source.empty()      , true );
+
+        EXPECT_EQ( copy .kth_smallest( 0, 2, 1 ), 3 );
+        EXPECT_EQ( moved.element_at( 0 )        , 4 );
+}
+
+TEST( WaveletMatrixTest, RandomQueries )
+{
+        constexpr std::size_t count = 300;
+
+        npl::vector< long > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                source.push_back( static_cast< long >( ( i * 7919 ) % 113 ) - 50 );
+        }
+        npl::wavelet_matrix< long > wm( source.begin(), source.end() );
+
+        EXPECT_EQ( wm._invariants(), true );
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                EXPECT_EQ( wm.element_at( i ), source[ i ] );
+        }
+        for( std::size_t x = 0; x < count; x += 17 )
+        {
+                for( std::size_t y = x; y < count; y += 23 )
+                {
+                        std::vector< long > sorted;
+
+                        for( std::size_t i = x; i <= y; ++i )
+                        {
+                                sorted.push_back( source[ i ] );
+                        }
+                        std::sort( sorted.begin(), sorted.end() );
+
+                        for( std::size_t k = 0; k < sorted.size(); k += 3 )
+                        {
+                                EXPECT_EQ( wm.kth_smallest( x, y, k ), sorted[ k ] );
+                        }
+                        for( long val = -60; val <= 70; val += 9 )
+                        {
+                                std::size_t expected = static_cast< std::size_t >( std::lower_bound( sorted.begin(), sorted.end(), val ) - sorted.begin() );
+
+                                EXPECT_EQ( wm.count_less( x, y, val ), expected );
+                        }
+                }
+        }
+}
@@ -0,0 +1,9 @@
+//
+//
+//      natprolib
+//      gtest_wavelet.hpp
+//
+
+#pragma once
+
+#include "gtest_nplib.hpp"
@@ -0,0 +1,83 @@
+//
+//
+//      natprolib
+//      gtest_wide_segtree.cpp
+//
+
+#include "gtest_wide_segtree.hpp"
+
+
+TEST( WideSegmentTreeTest, DefaultConstruct )
+{
+        npl::wide_segment_tree< int > seg;
+
+        EXPECT_EQ( seg._invariants(), true );
+        EXPECT_EQ( seg.empty()      , true );
+}
+
+TEST( WideSegmentTreeTest, FillConstruct )
+{
+        npl::wide_segment_tree< int > seg( 1000, CUSTOM_VALUE );
+
+        EXPECT_EQ( seg._invariants(),  true );
+        EXPECT_EQ( seg.size()       ,  1000 );
+        EXPECT_EQ( seg.height()     ,     3 );
+        EXPECT_EQ( seg.range()      ,  1000 );
+        EXPECT_EQ( seg.range( 3, 516 ), 514 );
+}
+
+TEST( WideSegmentTreeTest, CopyMove )
+{
+        npl::wide_segment_tree< long, npl::reduce_max< long > > source( { 4, 8, 15, 16, 23, 42, 7, 1, 3, 9 } );
+
+        npl::wide_segment_tree< long, npl::reduce_max< long > > copy( source );
+        npl::wide_segment_tree< long, npl::reduce_max< long > > moved( NPL_MOVE( source ) );
+
+        EXPECT_EQ( source._invariants(), true );
+        EXPECT_EQ( source.empty()      , true );
+        EXPECT_EQ( copy  ._invariants(), true );
+
+        for( std::size_t i = 0; i < copy.size(); ++i )
+        {
+                EXPECT_EQ( copy.element_at( i ), moved.element_at( i ) );
+        }
+        EXPECT_EQ( copy.range(),  42 );
+        EXPECT_EQ( copy.range( 6, 9 ), 9 );
+
+        source = copy;
+
+        EXPECT_EQ( source.range( 0, 3 ), 16 );
+}
+
+TEST( WideSegmentTreeTest, Sum )
+{
+        for( std::size_t count : { 1, 15, 16, 17, 300, 5000 } )
+        {
+                check_wide_segtree<    int, npl::reduce_sum<    int > >( count );
+                check_wide_segtree<   long, npl::reduce_sum<   long > >( count );
+                check_wide_segtree<  float, npl::reduce_sum<  float > >( count );
+                check_wide_segtree< double, npl::reduce_sum< double > >( count );
+        }
+}
+
+TEST( WideSegmentTreeTest, Min )
+{
+        for( std::size_t count : { 1, 15, 16, 17, 300, 5000 } )
+        {
+                check_wide_segtree<    int, npl::reduce_min<    int > >( count );
+                check_wide_segtree<  short, npl::reduce_min<  short > >( count );
+                check_wide_segtree<  float, npl::reduce_min<  float > >( count );
+                check_wide_segtree< double, npl::reduce_min< double > >( count );
+        }
+}
+
+TEST( WideSegmentTreeTest, Max )
+{
+        for( std::size_t count : { 1, 15, 16, 17, 300, 5000 } )
+        {
+                check_wide_segtree<    int, npl::reduce_max<    int > >( count );
+                check_wide_segtree<   long, npl::reduce_max<   long > >( count );
+                check_wide_segtree<  float, npl::reduce_max<  float > >( count );
+                check_wide_segtree< double, npl::reduce_max< double > >( count );
+        }
+}
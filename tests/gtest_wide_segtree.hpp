@@ -0,0 +1,64 @@
+//
+//
+//      natprolib
+//      gtest_wide_segtree.hpp
+//
+
+#pragma once
+
+#include "gtest_nplib.hpp"
+
+
+template< typename T, typename Reducer >
+T naive_reduce ( std::vector< T > const & values, std::size_t x, std::size_t y )
+{
+        T res = Reducer::identity();
+
+        for( std::size_t i = x; i <= y; ++i )
+        {
+                res = Reducer()( res, values[ i ] );
+        }
+        return res;
+}
+
+template< typename T, typename Reducer >
+void check_wide_segtree ( std::size_t const count )
+{
+        std::vector< T > naive( count );
+        npl::vector< T > source;
+
+        for( std::size_t i = 0; i < count; ++i )
+        {
+                naive[ i ] = static_cast< T >( ( i * 37 ) % 101 ) - static_cast< T >( 50 );
+                source.push_back( naive[ i ] );
+        }
+
+        npl::wide_segment_tree< T, Reducer > seg( source.begin(), source.end() );
+
+        EXPECT_EQ( seg._invariants(), true );
+        EXPECT_EQ( seg.size()       , count );
+        EXPECT_EQ( seg.range()      , ( naive_reduce< T, Reducer >( naive, 0, count - 1 ) ) );
+
+        for( std::size_t step = 0; step < 300; ++step )
+        {
+                std::size_t x = ( step * 7919 ) % count;
+                std::size_t y = x + ( step * 104729 ) % ( count - x );
+
+                EXPECT_EQ( seg.range( x, y ), ( naive_reduce< T, Reducer >( naive, x, y ) ) );
+
+                std::size_t pos = ( step * 613 ) % count;
+                T           val = static_cast< T >( step % 23 ) - static_cast< T >( 11 );
+
+                seg.update( pos, val );
+                naive[ pos ] = val;
+
+                EXPECT_EQ( seg.element_at( pos ), val );
+        }
+        for( std::size_t i = 0; i < count; i += 1 + count / 64 )
+        {
+                for( std::size_t j = i; j < count; j += 1 + count / 32 )
+                {
+                        EXPECT_EQ( seg.range( i, j ), ( naive_reduce< T, Reducer >( naive, i, j ) ) );
+                }
+        }
+}